@@ -1,63 +1,160 @@
 #include "arg_min_tiling.h"
+#include "arg_min_layout.h"
 #include "register/op_def_registry.h"
 #include "tiling/platform/platform_ascendc.h"
+#include "../../common/launch_trace.h"
+#include "../../common/tiling_cache.h"
 
 namespace optiling {
-// ... TilingFunc ...
-// (保持 TilingFunc 不变，问题根源在 InferShape 和 OpDef 的协同)
-static ge::graphStatus TilingFunc(gert::TilingContext* context)
+// ASCEND_OPS_TRACE_DIR 打开时记录本次 launch，attrs 布局: [dim, keepdim, dims 个数, dims..., dtype, masked_index, mask_bitpacked]
+static void CaptureTrace(gert::TilingContext* context, uint64_t elem_bytes)
+{
+    launch_trace::TraceRecord rec;
+    rec.op = launch_trace::TRACE_OP_ARG_MIN;
+    rec.dtype = static_cast<int32_t>(context->GetInputDesc(0)->GetDataType());
+    rec.format = static_cast<int32_t>(context->GetInputDesc(0)->GetStorageFormat());
+    const gert::Shape &ss = context->GetInputShape(0)->GetStorageShape();
+    uint64_t elems = 1;
+    for (size_t i = 0; i < ss.GetDimNum(); ++i) {
+        rec.dims.push_back(ss.GetDim(i));
+        elems *= static_cast<uint64_t>(ss.GetDim(i));
+    }
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    rec.attrs.push_back(*attrs->GetAttrPointer<int>(0));
+    rec.attrs.push_back(*attrs->GetAttrPointer<bool>(1) ? 1 : 0);
+    const gert::TypedContinuousVector<int64_t> *dims = attrs->GetListInt(2);
+    rec.attrs.push_back(dims == nullptr ? 0 : static_cast<int64_t>(dims->GetSize()));
+    for (size_t i = 0; dims != nullptr && i < dims->GetSize(); ++i) rec.attrs.push_back(dims->GetData()[i]);
+    rec.attrs.push_back(*attrs->GetAttrPointer<int>(3));
+    rec.attrs.push_back(*attrs->GetAttrPointer<int>(4));
+    rec.attrs.push_back(*attrs->GetAttrPointer<bool>(5) ? 1 : 0);
+    launch_trace::FillLaunch(rec, context);
+    // 输入数据只有在 host 侧可见时才能抓取，否则回放时按种子生成
+    const gert::Tensor *x = context->GetInputTensor(0);
+    if (launch_trace::TraceInputEnabled() && x != nullptr && x->GetAddr() != nullptr &&
+        (x->GetPlacement() == gert::kOnHost || x->GetPlacement() == gert::kFollowing)) {
+        const uint8_t *p = static_cast<const uint8_t *>(x->GetAddr());
+        rec.payload.assign(p, p + elems * elem_bytes);
+    }
+    launch_trace::WriteTrace(rec, "arg_min");
+}
+
+
+/*
+ * NC1HWC0 输入只支持沿 C 归约(原始 shape NCHW 的第 1 维)：
+ * 存储 shape [N, C1, H, W, C0] 看成 [N, C1, H*W*C0]，沿 C1 走平面路径，kernel 再在块内折叠 C0。
+ */
+static bool Compute5HdLayout(gert::TilingContext* context, arg_min_layout::ArgMinLayout &layout,
+                             uint32_t &c0, uint32_t &c_valid, uint32_t &hw)
+{
+    const gert::StorageShape* in_shape = context->GetInputShape(0);
+    const auto &origin = in_shape->GetOriginShape();
+    const auto &ss = in_shape->GetStorageShape();
+    auto dtype = context->GetInputDesc(0)->GetDataType();
+    if (origin.GetDimNum() != 4 || ss.GetDimNum() != 5) return false;
+    if (dtype != ge::DT_FLOAT16 && dtype != ge::DT_FLOAT) return false;
+
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    const gert::TypedContinuousVector<int64_t> *red_dims = attrs->GetListInt(2);
+    int64_t d = *attrs->GetAttrPointer<int>(0);
+    if (red_dims != nullptr && red_dims->GetSize() > 0) {
+        if (red_dims->GetSize() != 1) return false;
+        d = red_dims->GetData()[0];
+    }
+    if (d < 0) d += 4;
+    if (d != 1) return false;
+
+    const int64_t c1 = ss.GetDim(1);
+    c0 = static_cast<uint32_t>(ss.GetDim(4));
+    c_valid = static_cast<uint32_t>(origin.GetDim(1));
+    hw = static_cast<uint32_t>(ss.GetDim(2) * ss.GetDim(3));
+    // C0 需整除一次向量 repeat 的元素数，填充通道的掩码才能按 repeat 复用
+    if (c0 == 0 || 64 % c0 != 0 || c1 <= 0) return false;
+    if (c_valid > c1 * c0 || c_valid <= (c1 - 1) * c0) return false;
+
+    int64_t flat[3] = {ss.GetDim(0), c1, static_cast<int64_t>(hw) * c0};
+    return arg_min_layout::ComputeArgMinLayout(flat, 3, 1, layout);
+}
+
+/*
+ * 可选掩码(输入 1)：bool 时与 x 同元素数；mask_bitpacked 时按展平下标每字节 8 个元素(LSB 在前)，
+ * 此时 kernel 直接把字节当 Select 位图，每行/段起点必须落在字节边界上。
+ */
+static bool CheckMask(gert::TilingContext* context, const arg_min_layout::ArgMinLayout &layout, bool is5hd,
+                      bool &has_mask, bool &packed)
+{
+    const gert::StorageShape *mask_shape = context->GetOptionalInputShape(1);
+    packed = *context->GetAttrs()->GetAttrPointer<bool>(5);
+    has_mask = mask_shape != nullptr;
+    if (!has_mask) return true;
+    if (is5hd) return false;
+    const auto &ms = mask_shape->GetStorageShape();
+    uint64_t n = 1;
+    for (size_t i = 0; i < ms.GetDimNum(); ++i) n *= static_cast<uint64_t>(ms.GetDim(i));
+    if (n != (packed ? (layout.total + 7) / 8 : layout.total)) return false;
+    if (packed) {
+        const uint64_t run = layout.stride_m == 1 ? layout.seg_len : layout.stride_m;
+        const bool single = layout.outer == 1 && layout.inner == layout.seg_len;
+        if (run % 8 != 0 && !single) return false;
+    }
+    return true;
+}
+
+static uint64_t ElemBytes(ge::DataType dtype)
+{
+    if (dtype == ge::DT_FLOAT16 || dtype == ge::DT_BF16 || dtype == ge::DT_INT16) return 2;
+    if (dtype == ge::DT_INT8 || dtype == ge::DT_UINT8) return 1;
+    if (dtype == ge::DT_INT64) return 8;
+    return 4;
+}
+
+static ge::graphStatus ComputeTiling(gert::TilingContext* context)
 {
     ArgMinTilingData tiling;
     const gert::StorageShape* in_shape = context->GetInputShape(0);
     const auto &ss = in_shape->GetStorageShape();
     int32_t rank = ss.GetDimNum();
 
-    uint64_t total_elems = 1;
+    int64_t dims[gert::Shape::kMaxDimNum];
     for (int i = 0; i < rank; ++i) {
-        total_elems *= static_cast<uint64_t>(ss.GetDim(i));
+        dims[i] = ss.GetDim(i);
     }
 
     const gert::RuntimeAttrs *attrs = context->GetAttrs();
     int16_t dim_attr = *attrs->GetAttrPointer<int>(0);
+    const gert::TypedContinuousVector<int64_t> *red_dims = attrs->GetListInt(2);
 
-    bool global_reduce = (dim_attr == 255);
-    int16_t dim = -1;
-
-    if (!global_reduce) {
-        if (rank == 0) {
-            global_reduce = true;
-        } else {
-            int64_t d = dim_attr;
-            if (d < 0) d += rank;
-            if (d < 0 || d >= rank) return ge::GRAPH_FAILED;
-            dim = static_cast<int16_t>(d);
-        }
-    }
-    
-    uint64_t inner = 0;
-    uint64_t outer = 0;
-    uint64_t stride_m = 1;
-
-    if (global_reduce) {
-        inner = static_cast<uint64_t>(total_elems);
-        outer = 1;
-        dim = 0; 
-    } else {
-        inner = static_cast<uint64_t>(ss.GetDim(dim));
-        outer = total_elems / inner;
-        if (dim < rank - 1) {
-            stride_m = 1;
-            for (int i = dim + 1; i < rank; ++i) {
-                stride_m *= static_cast<uint64_t>(ss.GetDim(i));
-            }
+    // dims 非空时按多轴归约，覆盖 dim
+    arg_min_layout::ArgMinLayout layout;
+    uint32_t c0 = 0, c_valid = 0, hw = 0;
+    // storage format 可能带子格式/C0 位，只比较主格式
+    const bool is5hd = ge::GetPrimaryFormat(static_cast<int32_t>(context->GetInputDesc(0)->GetStorageFormat())) ==
+                       ge::FORMAT_NC1HWC0;
+    if (is5hd) {
+        if (!Compute5HdLayout(context, layout, c0, c_valid, hw)) return ge::GRAPH_FAILED;
+    } else if (red_dims != nullptr && red_dims->GetSize() > 0) {
+        if (rank == 0 || !arg_min_layout::ComputeArgMinLayoutMulti(dims, rank, red_dims->GetData(),
+                                                                    red_dims->GetSize(), layout)) {
+            return ge::GRAPH_FAILED;
         }
+    } else if (!arg_min_layout::ComputeArgMinLayout(dims, rank, dim_attr, layout)) {
+        return ge::GRAPH_FAILED;
     }
+    const int16_t dim = layout.dim;
+    const uint64_t total_elems = layout.total;
+    const uint64_t inner = layout.inner;
+    const uint64_t outer = layout.outer;
+    const uint64_t stride_m = layout.stride_m;
 
-    uint64_t elem_bytes = 4;
-    auto dtype = context->GetInputDesc(0)->GetDataType();
-    if (dtype == ge::DT_FLOAT16 || dtype == ge::DT_BF16 || dtype == ge::DT_INT16) elem_bytes = 2;
-    else if (dtype == ge::DT_INT8 || dtype == ge::DT_UINT8) elem_bytes = 1;
-    else if (dtype == ge::DT_INT64) elem_bytes = 8;
+    // int32 下标只在被归约元素数可以用 int32 表示时允许
+    const int64_t idx_dtype = *attrs->GetAttrPointer<int>(3);
+    if (idx_dtype != ge::DT_INT64 && idx_dtype != ge::DT_INT32) return ge::GRAPH_FAILED;
+    if (idx_dtype == ge::DT_INT32 && inner > static_cast<uint64_t>(INT32_MAX)) return ge::GRAPH_FAILED;
+
+    bool has_mask = false, mask_packed = false;
+    if (!CheckMask(context, layout, is5hd, has_mask, mask_packed)) return ge::GRAPH_FAILED;
+
+    const uint64_t elem_bytes = ElemBytes(context->GetInputDesc(0)->GetDataType());
 
     tiling.set_dim(dim); 
     tiling.set_rank(static_cast<uint32_t>(rank));
@@ -66,15 +163,87 @@ static ge::graphStatus TilingFunc(gert::TilingContext* context)
     tiling.set_size(static_cast<uint32_t>(total_elems));
     tiling.set_elem_bytes(elem_bytes);
     tiling.set_stride_m(stride_m);
-    if(stride_m == 1) context->SetTilingKey(1);
+    uint32_t outer_dims[arg_min_layout::MAX_GROUPS] = {0};
+    uint32_t outer_strides[arg_min_layout::MAX_GROUPS] = {0};
+    uint32_t red_dims_t[arg_min_layout::MAX_GROUPS] = {0};
+    uint32_t red_strides[arg_min_layout::MAX_GROUPS] = {0};
+    for (uint32_t i = 0; i < layout.outer_rank; ++i) {
+        outer_dims[i] = static_cast<uint32_t>(layout.outer_dims[i]);
+        outer_strides[i] = static_cast<uint32_t>(layout.outer_strides[i]);
+    }
+    for (uint32_t i = 0; i < layout.red_rank; ++i) {
+        red_dims_t[i] = static_cast<uint32_t>(layout.red_dims[i]);
+        red_strides[i] = static_cast<uint32_t>(layout.red_strides[i]);
+    }
+    tiling.set_seg_len(static_cast<uint32_t>(layout.seg_len));
+    tiling.set_outer_rank(layout.outer_rank);
+    tiling.set_outer_dims(outer_dims);
+    tiling.set_outer_strides(outer_strides);
+    tiling.set_red_rank(layout.red_rank);
+    tiling.set_red_dims(red_dims_t);
+    tiling.set_red_strides(red_strides);
+    tiling.set_c0(c0);
+    tiling.set_c_valid(c_valid);
+    tiling.set_hw(hw);
+    tiling.set_has_mask(has_mask ? 1 : 0);
+    tiling.set_mask_bitpacked(mask_packed ? 1 : 0);
+    tiling.set_masked_index(*attrs->GetAttrPointer<int>(4));
+    if (is5hd) context->SetTilingKey(2);
+    else if(stride_m == 1) context->SetTilingKey(1);
     else context->SetTilingKey(0);
     context->SetBlockDim(1);
     tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
     context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
     return ge::GRAPH_SUCCESS;
 }
+
+static tiling_cache::TilingCache &Cache()
+{
+    static tiling_cache::TilingCache cache(tiling_cache::CapacityFromEnv());
+    return cache;
+}
+
+// tiling 只依赖 x 的存储/原始 shape、dtype、format，掩码是否存在及其 shape，全部属性与平台
+static void BuildCacheKey(gert::TilingContext* context, tiling_cache::KeyBuilder &key)
+{
+    const gert::StorageShape *in_shape = context->GetInputShape(0);
+    const gert::StorageShape *mask_shape = context->GetOptionalInputShape(1);
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    key.Add(static_cast<int64_t>(ascendcPlatform.GetSocVersion()))
+       .Add(ascendcPlatform.GetCoreNumAiv())
+       .Add(context->GetInputDesc(0)->GetDataType())
+       .Add(context->GetInputDesc(0)->GetStorageFormat())
+       .AddShape(in_shape->GetStorageShape())
+       .AddShape(in_shape->GetOriginShape())
+       .Add(mask_shape != nullptr ? 1 : 0);
+    if (mask_shape != nullptr) key.AddShape(mask_shape->GetStorageShape());
+    key.Add(*attrs->GetAttrPointer<int>(0))
+       .Add(*attrs->GetAttrPointer<bool>(1) ? 1 : 0)
+       .AddList(attrs->GetListInt(2))
+       .Add(*attrs->GetAttrPointer<int>(3))
+       .Add(*attrs->GetAttrPointer<int>(4))
+       .Add(*attrs->GetAttrPointer<bool>(5) ? 1 : 0);
+}
+
+// 命中时直接写回缓存的 tiling；trace 抓取在命中与未命中时都做
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    tiling_cache::KeyBuilder key;
+    BuildCacheKey(context, key);
+    if (!tiling_cache::Apply(Cache(), key.Str(), context)) {
+        if (ComputeTiling(context) != ge::GRAPH_SUCCESS) return ge::GRAPH_FAILED;
+        tiling_cache::Store(Cache(), key.Str(), context);
+    }
+    if (launch_trace::TraceDir() != nullptr) {
+        CaptureTrace(context, ElemBytes(context->GetInputDesc(0)->GetDataType()));
+    }
+    return ge::GRAPH_SUCCESS;
+}
 } // namespace optiling
 
+TILING_CACHE_EXPORT_STATS(arg_min, optiling::Cache())
+
 namespace ge {
 static ge::graphStatus InferShape(gert::InferShapeContext* context)
 {
@@ -87,12 +256,33 @@ static ge::graphStatus InferShape(gert::InferShapeContext* context)
     bool keepdim = *attrs->GetAttrPointer<int>(1);
 
     int32_t rank = in_shape->GetDimNum();
+    // 多轴：被归约轴 keepdim 时置 1，否则删除；标量没有可归约的轴，与 tiling 一致拒绝非空 dims
+    const gert::TypedContinuousVector<int64_t> *red_dims = attrs->GetListInt(2);
+    const bool multi = red_dims != nullptr && red_dims->GetSize() > 0;
     if (rank == 0) {
+        if (multi) return GRAPH_FAILED;
         if (keepdim) { out_shape->SetDimNum(1); out_shape->SetDim(0, 1); }
         else { out_shape->SetDimNum(0); }
         return GRAPH_SUCCESS;
     }
 
+    if (multi) {
+        bool reduced[gert::Shape::kMaxDimNum] = {false};
+        for (size_t i = 0; i < red_dims->GetSize(); ++i) {
+            int64_t d = red_dims->GetData()[i];
+            if (d < 0) d += rank;
+            if (d < 0 || d >= rank || reduced[d]) return GRAPH_FAILED;
+            reduced[d] = true;
+        }
+        int out_i = 0;
+        out_shape->SetDimNum(keepdim ? rank : rank - static_cast<int32_t>(red_dims->GetSize()));
+        for (int i = 0; i < rank; ++i) {
+            if (!reduced[i]) out_shape->SetDim(out_i++, in_shape->GetDim(i));
+            else if (keepdim) out_shape->SetDim(out_i++, 1);
+        }
+        return GRAPH_SUCCESS;
+    }
+
     if (dim_attr == 255) { // 全局
         if (keepdim) {
             out_shape->SetDimNum(1);
@@ -126,7 +316,8 @@ static ge::graphStatus InferShape(gert::InferShapeContext* context)
 
 static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
 {
-    context->SetOutputDataType(0, ge::DT_INT64);
+    const int *dtype = context->GetAttrs()->GetAttrPointer<int>(3);
+    context->SetOutputDataType(0, (dtype != nullptr && *dtype == ge::DT_INT32) ? ge::DT_INT32 : ge::DT_INT64);
     return GRAPH_SUCCESS;
 }
 } // namespace ge
@@ -137,18 +328,47 @@ class ArgMin : public OpDef {
 public:
     explicit ArgMin(const char* name) : OpDef(name)
     {
+        // 前 16 组为 ND(int64/int32 下标)，后 4 组为 NC1HWC0 沿 C 归约，输出 ND
         this->Input("x")
             .ParamType(REQUIRED)
-            .DataType({ge::DT_BF16, ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32, ge::DT_INT8, ge::DT_INT64, ge::DT_INT16, ge::DT_UINT8})
-            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
-            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+            .DataType({ge::DT_BF16, ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32, ge::DT_INT8, ge::DT_INT64, ge::DT_INT16, ge::DT_UINT8,
+                       ge::DT_BF16, ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32, ge::DT_INT8, ge::DT_INT64, ge::DT_INT16, ge::DT_UINT8,
+                       ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_FLOAT, ge::DT_FLOAT16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                     ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                     ge::FORMAT_NC1HWC0, ge::FORMAT_NC1HWC0, ge::FORMAT_NC1HWC0, ge::FORMAT_NC1HWC0})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                                 ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                                 ge::FORMAT_NC1HWC0, ge::FORMAT_NC1HWC0, ge::FORMAT_NC1HWC0, ge::FORMAT_NC1HWC0});
+        // 可选掩码：true 的元素参与比较；mask_bitpacked 时按字节存 8 个元素的位(NC1HWC0 不支持掩码)
+        this->Input("mask")
+            .ParamType(OPTIONAL)
+            .DataType({ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL,
+                       ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL,
+                       ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL, ge::DT_BOOL})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                     ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                     ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                                 ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                                 ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
         this->Output("y")
             .ParamType(REQUIRED)
-            .DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64})
-            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
-            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+            .DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64,
+                       ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32, ge::DT_INT32,
+                       ge::DT_INT64, ge::DT_INT64, ge::DT_INT32, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                     ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                     ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                                 ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND,
+                                 ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
         this->Attr("dim").AttrType(OPTIONAL).Int(255);
         this->Attr("keepdim").AttrType(OPTIONAL).Bool(false);
+        this->Attr("dims").AttrType(OPTIONAL).ListInt({});
+        this->Attr("dtype").AttrType(OPTIONAL).Int(ge::DT_INT64);
+        this->Attr("masked_index").AttrType(OPTIONAL).Int(-1);
+        this->Attr("mask_bitpacked").AttrType(OPTIONAL).Bool(false);
 
         this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
 
@@ -0,0 +1,34 @@
+#ifndef ARG_MIN_INFER_SHAPE_H
+#define ARG_MIN_INFER_SHAPE_H
+#include "arg_min_layout.h"
+#include "register/op_def_registry.h"
+
+namespace ge {
+// 与 ArgMin 的 InferShape 相同的单轴规则，供 ArgMin 的变体(分组、流式)复用
+inline ge::graphStatus InferReducedShape(const gert::Shape &in, gert::Shape &out, int64_t dim_attr, bool keepdim)
+{
+    int32_t rank = in.GetDimNum();
+    if (rank == 0 || dim_attr == arg_min_layout::GLOBAL_REDUCE_DIM) {
+        if (keepdim) { out.SetDimNum(1); out.SetDim(0, 1); }
+        else { out.SetDimNum(0); }
+        return GRAPH_SUCCESS;
+    }
+    int64_t d = dim_attr;
+    if (d < 0) d += rank;
+    if (d < 0 || d >= rank) return GRAPH_FAILED;
+    if (keepdim) {
+        out.SetDimNum(rank);
+        for (int i = 0; i < rank; ++i) out.SetDim(i, (i == d) ? 1 : in.GetDim(i));
+    } else {
+        out.SetDimNum(rank - 1);
+        int out_i = 0;
+        for (int i = 0; i < rank; ++i) {
+            if (i == d) continue;
+            out.SetDim(out_i++, in.GetDim(i));
+        }
+    }
+    return GRAPH_SUCCESS;
+}
+} // namespace ge
+
+#endif // ARG_MIN_INFER_SHAPE_H
@@ -0,0 +1,147 @@
+#include "arg_min_k_tiling.h"
+#include "arg_min_layout.h"
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+#include <algorithm>
+
+namespace optiling {
+constexpr int64_t ARG_MIN_K_MAX_K = 16;      // 与 kernel 中标量 k 表的容量一致
+constexpr uint64_t UB_RESERVED_BYTES = 8192; // 各 buffer 的 32B 尾部填充、mask 对齐等
+constexpr uint64_t COL_ALIGN = 128;          // half 的一个 repeat，float 的两个 repeat
+constexpr uint64_t MAX_TILE_INNER = 24576;   // 与 KernelArgMin 的 TILE_INNER 相同
+
+/*
+ * 平面路径每列占用的 UB 字节数，必须与 KernelArgMinK::Init 的平面路径一致：
+ *   行双缓冲 2*es、bf16 的 cast 缓冲 4、候选值临时 cs、候选/临时下标 2*4、
+ *   k 层 (值, 下标) k*(cs+4)、int64 写回 8、mask 1
+ */
+static uint64_t PlaneBytesPerCol(ge::DataType dtype, uint64_t k)
+{
+    const uint64_t es = (dtype == ge::DT_FLOAT16 || dtype == ge::DT_BF16) ? 2 : 4;
+    const uint64_t cs = (dtype == ge::DT_FLOAT16) ? 2 : 4;
+    uint64_t bytes = 2 * es + cs + 2 * 4 + k * (cs + 4) + 8 + 1;
+    if (dtype == ge::DT_BF16) bytes += 4;
+    return bytes;
+}
+
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    ArgMinKTilingData tiling;
+    const auto &ss = context->GetInputShape(0)->GetStorageShape();
+    int32_t rank = ss.GetDimNum();
+    int64_t dims[gert::Shape::kMaxDimNum];
+    for (int i = 0; i < rank; ++i) {
+        dims[i] = ss.GetDim(i);
+    }
+
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    int64_t dim_attr = *attrs->GetAttrPointer<int>(0);
+    int64_t k = *attrs->GetAttrPointer<int>(1);
+
+    arg_min_layout::ArgMinLayout layout;
+    if (!arg_min_layout::ComputeArgMinLayout(dims, rank, dim_attr, layout)) return ge::GRAPH_FAILED;
+    if (k < 1 || k > ARG_MIN_K_MAX_K || static_cast<uint64_t>(k) > layout.inner) return ge::GRAPH_FAILED;
+
+    auto dtype = context->GetInputDesc(0)->GetDataType();
+    if (dtype != ge::DT_FLOAT && dtype != ge::DT_FLOAT16 && dtype != ge::DT_BF16 && dtype != ge::DT_INT32) {
+        return ge::GRAPH_FAILED;
+    }
+    const uint64_t es = (dtype == ge::DT_FLOAT16 || dtype == ge::DT_BF16) ? 2 : 4;
+    const uint64_t cs = (dtype == ge::DT_FLOAT16) ? 2 : 4;
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    uint64_t ub_size = 0;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ub_size);
+    const uint64_t budget = ub_size > UB_RESERVED_BYTES ? ub_size - UB_RESERVED_BYTES : 0;
+
+    // 平面路径：k 越大每列占用越多，列块越小；不超过 stride_m 向上对齐
+    uint64_t tile_col = budget / PlaneBytesPerCol(dtype, k) / COL_ALIGN * COL_ALIGN;
+    tile_col = std::min(tile_col, (layout.stride_m + COL_ALIGN - 1) / COL_ALIGN * COL_ALIGN);
+    if (layout.stride_m != 1 && tile_col == 0) return ge::GRAPH_FAILED;
+
+    // slice 路径：输入 tile + ReduceMin 工作区(约 tile/8 个 CmpT)
+    uint64_t tile_inner = budget / (es + cs) / COL_ALIGN * COL_ALIGN;
+    tile_inner = std::min({tile_inner, MAX_TILE_INNER, (layout.inner + COL_ALIGN - 1) / COL_ALIGN * COL_ALIGN});
+
+    tiling.set_inner(static_cast<uint32_t>(layout.inner));
+    tiling.set_outer(static_cast<uint32_t>(layout.outer));
+    tiling.set_stride_m(static_cast<uint32_t>(layout.stride_m));
+    tiling.set_k(static_cast<uint32_t>(k));
+    tiling.set_tile_col(static_cast<uint32_t>(tile_col));
+    tiling.set_tile_inner(static_cast<uint32_t>(tile_inner));
+
+    // 各输出位置相互独立，按 slice / 平面分核
+    const uint64_t units = layout.stride_m == 1 ? layout.outer : layout.outer / layout.stride_m;
+    uint64_t cores = std::max<uint32_t>(1, ascendcPlatform.GetCoreNumAiv());
+    cores = std::max<uint64_t>(1, std::min(cores, units));
+    context->SetTilingKey(layout.stride_m == 1 ? 1 : 0);
+    context->SetBlockDim(static_cast<uint32_t>(cores));
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace optiling
+
+namespace ge {
+// 输出 shape 为输入 shape 把 dim 换成 k；全局归约时为 [k]
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const gert::Shape* in_shape = context->GetInputShape(0);
+    gert::Shape* out_shape = context->GetOutputShape(0);
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    int64_t dim_attr = *attrs->GetAttrPointer<int>(0);
+    int64_t k = *attrs->GetAttrPointer<int>(1);
+
+    int32_t rank = in_shape->GetDimNum();
+    if (rank == 0 || dim_attr == arg_min_layout::GLOBAL_REDUCE_DIM) {
+        out_shape->SetDimNum(1);
+        out_shape->SetDim(0, k);
+        return GRAPH_SUCCESS;
+    }
+    int64_t d = dim_attr;
+    if (d < 0) d += rank;
+    if (d < 0 || d >= rank) return GRAPH_FAILED;
+    out_shape->SetDimNum(rank);
+    for (int i = 0; i < rank; ++i) {
+        out_shape->SetDim(i, (i == d) ? k : in_shape->GetDim(i));
+    }
+    return GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    context->SetOutputDataType(0, ge::DT_INT64);
+    return GRAPH_SUCCESS;
+}
+} // namespace ge
+
+
+namespace ops {
+class ArgMinK : public OpDef {
+public:
+    explicit ArgMinK(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_BF16, ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Attr("dim").AttrType(OPTIONAL).Int(255);
+        this->Attr("k").AttrType(OPTIONAL).Int(1);
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend310b");
+
+    }
+};
+
+OP_ADD(ArgMinK);
+}
@@ -0,0 +1,15 @@
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(ArgMinKTilingData)
+  TILING_DATA_FIELD_DEF(uint32_t, inner);      // 轴分解同 ArgMinTilingData
+  TILING_DATA_FIELD_DEF(uint32_t, outer);
+  TILING_DATA_FIELD_DEF(uint32_t, stride_m);
+  TILING_DATA_FIELD_DEF(uint32_t, k);          // 返回的下标个数，1 <= k <= min(16, inner)
+  TILING_DATA_FIELD_DEF(uint32_t, tile_col);   // 平面路径每次处理的列数，按 k 与 UB 大小算出
+  TILING_DATA_FIELD_DEF(uint32_t, tile_inner); // slice 路径每个 tile 的元素数
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(ArgMinK, ArgMinKTilingData)
+}
@@ -0,0 +1,112 @@
+#ifndef ARG_MIN_LAYOUT_H
+#define ARG_MIN_LAYOUT_H
+/*
+ * ArgMin 的轴分解：把 (shape, 被归约轴集合) 归为 outer 个长度为 inner 的归约。
+ * 相邻的同类轴(都归约或都保留)合并成组，被归约轴可以不相邻：
+ *   末组是归约组时 stride_m == 1，每个输出对应若干段长 seg_len 的连续 slice(tiling key 1)，
+ *     段的起点按其余归约组混合进制展开；
+ *   末组是保留组时 stride_m 为末组长度，每个平面 inner 行、每行 stride_m 个连续元素(tiling key 0)，
+ *     行的起点按归约组混合进制展开，平面的起点按其余保留组展开。
+ * 输出下标是归约子空间内按行优先展平的下标。单轴时退化为原来的 inner/outer/stride_m 分解。
+ * 不依赖 CANN 头文件，ArgMin 及其变体的 tiling、离线分析工具共用。
+ */
+#include <cstdint>
+
+namespace arg_min_layout {
+constexpr int64_t GLOBAL_REDUCE_DIM = 255;  // dim 属性取该值表示全局 flatten 归约
+constexpr int32_t MAX_RANK = 8;
+constexpr int32_t MAX_GROUPS = 4;            // 8 维交替出现时每类最多 4 组
+
+struct ArgMinLayout {
+    int16_t  dim = 0;       // 归一化后的(第一个)被归约轴，全局归约时为 0
+    bool     global = false;
+    uint64_t total = 1;     // 输入元素数
+    uint64_t inner = 1;     // 被归约元素数
+    uint64_t outer = 1;     // 其余维乘积，即输出元素数
+    uint64_t stride_m = 1;  // 末组为保留组时为其长度，否则为 1
+    uint64_t seg_len = 1;   // slice 路径每段连续归约元素数
+    uint32_t outer_rank = 0;                  // 平面/slice 起点的保留组(不含作为列的末组)
+    uint64_t outer_dims[MAX_GROUPS] = {0};
+    uint64_t outer_strides[MAX_GROUPS] = {0};
+    uint32_t red_rank = 0;                    // 行/段起点的归约组(slice 路径不含末组)
+    uint64_t red_dims[MAX_GROUPS] = {0};
+    uint64_t red_strides[MAX_GROUPS] = {0};
+};
+
+/* red 为被归约轴列表(可为负、无序，不可重复) */
+inline bool ComputeArgMinLayoutMulti(const int64_t *dims, int32_t rank, const int64_t *red, int32_t red_n,
+                                     ArgMinLayout &l)
+{
+    l = ArgMinLayout();
+    if (rank > MAX_RANK || red_n <= 0) return false;
+    for (int32_t i = 0; i < rank; ++i) l.total *= static_cast<uint64_t>(dims[i]);
+
+    bool reduced[MAX_RANK] = {false};
+    l.dim = static_cast<int16_t>(rank);
+    for (int32_t i = 0; i < red_n; ++i) {
+        int64_t d = red[i];
+        if (d < 0) d += rank;
+        if (d < 0 || d >= rank || reduced[d]) return false;
+        reduced[d] = true;
+        if (d < l.dim) l.dim = static_cast<int16_t>(d);
+    }
+
+    // 合并相邻同类轴
+    int32_t group_n = 0;
+    uint64_t group_size[MAX_RANK];
+    bool group_red[MAX_RANK];
+    for (int32_t i = 0; i < rank; ++i) {
+        if (group_n > 0 && group_red[group_n - 1] == reduced[i]) {
+            group_size[group_n - 1] *= static_cast<uint64_t>(dims[i]);
+        } else {
+            group_size[group_n] = static_cast<uint64_t>(dims[i]);
+            group_red[group_n++] = reduced[i];
+        }
+    }
+    uint64_t group_stride[MAX_RANK];
+    uint64_t acc = 1;
+    for (int32_t g = group_n - 1; g >= 0; --g) {
+        group_stride[g] = acc;
+        acc *= group_size[g];
+    }
+
+    // 末组作为 slice 的连续段(归约组)或平面的列(保留组)，其余组参与混合进制展开
+    const bool last_red = group_red[group_n - 1];
+    l.inner = 1;
+    l.outer = 1;
+    for (int32_t g = 0; g < group_n; ++g) {
+        (group_red[g] ? l.inner : l.outer) *= group_size[g];
+    }
+    l.stride_m = last_red ? 1 : group_size[group_n - 1];
+    l.seg_len = last_red ? group_size[group_n - 1] : 1;
+    for (int32_t g = 0; g + 1 < group_n; ++g) {
+        if (group_red[g]) {
+            if (l.red_rank == MAX_GROUPS) return false;
+            l.red_dims[l.red_rank] = group_size[g];
+            l.red_strides[l.red_rank++] = group_stride[g];
+        } else {
+            if (l.outer_rank == MAX_GROUPS) return false;
+            l.outer_dims[l.outer_rank] = group_size[g];
+            l.outer_strides[l.outer_rank++] = group_stride[g];
+        }
+    }
+    return true;
+}
+
+inline bool ComputeArgMinLayout(const int64_t *dims, int32_t rank, int64_t dim_attr, ArgMinLayout &l)
+{
+    l = ArgMinLayout();
+    l.global = (dim_attr == GLOBAL_REDUCE_DIM) || rank == 0;
+    if (l.global) {
+        for (int32_t i = 0; i < rank; ++i) l.total *= static_cast<uint64_t>(dims[i]);
+        l.inner = l.total;
+        l.outer = 1;
+        l.seg_len = l.total;
+        l.dim = 0;
+        return true;
+    }
+    return ComputeArgMinLayoutMulti(dims, rank, &dim_attr, 1, l);
+}
+} // namespace arg_min_layout
+
+#endif // ARG_MIN_LAYOUT_H
@@ -9,7 +9,23 @@ BEGIN_TILING_DATA_DEF(ArgMinTilingData)
   TILING_DATA_FIELD_DEF(uint32_t, inner);      // 被归约维长度
   TILING_DATA_FIELD_DEF(uint32_t, outer);      // 其余维乘积
   TILING_DATA_FIELD_DEF(uint32_t, elem_bytes); // 每个元素字节数
-  TILING_DATA_FIELD_DEF(uint32_t, stride_m);   // 非末维归约时为 ∏_{i>dim} N_i，否则为 1
+  TILING_DATA_FIELD_DEF(uint32_t, stride_m);   // 末组为保留组时为其长度(单轴即 ∏_{i>dim} N_i)，否则为 1
+  // 多轴归约的混合进制展开，见 arg_min_layout.h
+  TILING_DATA_FIELD_DEF(uint32_t, seg_len);    // slice 路径每段连续元素数
+  TILING_DATA_FIELD_DEF(uint32_t, outer_rank);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, outer_dims);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, outer_strides);
+  TILING_DATA_FIELD_DEF(uint32_t, red_rank);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, red_dims);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, red_strides);
+  // NC1HWC0 沿 C 归约(tiling key 2)，ND 时均为 0
+  TILING_DATA_FIELD_DEF(uint32_t, c0);         // 存储 shape 末维 C0
+  TILING_DATA_FIELD_DEF(uint32_t, c_valid);    // 原始 C，最后一个 C1 中超出的通道为填充
+  TILING_DATA_FIELD_DEF(uint32_t, hw);         // H * W，即每个 N 的输出数
+  // 可选掩码输入
+  TILING_DATA_FIELD_DEF(uint32_t, has_mask);
+  TILING_DATA_FIELD_DEF(uint32_t, mask_bitpacked); // 1: 掩码按位打包(LSB 在前)
+  TILING_DATA_FIELD_DEF(int32_t, masked_index);    // 全被屏蔽的输出写该下标
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(ArgMin, ArgMinTilingData)
@@ -0,0 +1,193 @@
+#include "grouped_arg_min_tiling.h"
+#include "arg_min_layout.h"
+#include "arg_min_infer_shape.h"
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+#include <algorithm>
+#include <vector>
+
+namespace optiling {
+// 每个 slice 的固定开销(结果暂存、流水启动)折算成的元素数，避免大量极短 slice 的组被低估
+constexpr uint64_t SLICE_OVERHEAD_ELEMS = 64;
+// 每核期望分到的工作项数，越多越均衡，但受 GROUPED_ARG_MIN_MAX_ITEMS 限制
+constexpr uint64_t ITEMS_PER_CORE = 4;
+
+struct GroupWork {
+    uint32_t group;
+    uint64_t units;      // slice 数或平面数
+    uint64_t unit_cost;  // 每个 slice/平面的代价(元素数)
+};
+
+struct WorkItem {
+    uint32_t group;
+    uint32_t begin;
+    uint32_t count;
+    uint64_t cost;
+};
+
+// dims 只给一个值时对所有组生效
+static int64_t GroupDim(const gert::TypedContinuousVector<int64_t> *dims, size_t g)
+{
+    return dims->GetSize() == 1 ? dims->GetData()[0] : dims->GetData()[g];
+}
+
+// 把长组切成约 target 代价的工作项，短组整组成一项；slice 组在前、平面组在后，kernel 按此顺序切换 UB 布局
+static void BuildItems(const std::vector<GroupWork> &slices, const std::vector<GroupWork> &planes,
+                       uint64_t target, std::vector<WorkItem> &items)
+{
+    items.clear();
+    for (const auto *works : {&slices, &planes}) {
+        for (const auto &w : *works) {
+            uint64_t per = std::max<uint64_t>(1, target / w.unit_cost);
+            for (uint64_t b = 0; b < w.units; b += per) {
+                uint64_t cnt = std::min(per, w.units - b);
+                items.push_back({w.group, static_cast<uint32_t>(b), static_cast<uint32_t>(cnt), cnt * w.unit_cost});
+            }
+        }
+    }
+}
+
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    GroupedArgMinTilingData tiling;
+    const size_t group_num = context->GetIrInputInstanceInfo(0)->GetInstanceNum();
+    auto *dims = context->GetAttrs()->GetListInt(0);
+    if (group_num == 0 || group_num > GROUPED_ARG_MIN_MAX_GROUPS) return ge::GRAPH_FAILED;
+    if (dims->GetSize() != 1 && dims->GetSize() != group_num) return ge::GRAPH_FAILED;
+
+    uint32_t inner[GROUPED_ARG_MIN_MAX_GROUPS] = {0};
+    uint32_t outer[GROUPED_ARG_MIN_MAX_GROUPS] = {0};
+    uint32_t stride_m[GROUPED_ARG_MIN_MAX_GROUPS] = {0};
+    std::vector<GroupWork> slices, planes;
+    uint64_t total_cost = 0;
+    for (size_t g = 0; g < group_num; ++g) {
+        const auto &ss = context->GetDynamicInputShape(0, g)->GetStorageShape();
+        int64_t shape[gert::Shape::kMaxDimNum];
+        for (size_t i = 0; i < ss.GetDimNum(); ++i) shape[i] = ss.GetDim(i);
+        arg_min_layout::ArgMinLayout l;
+        if (!arg_min_layout::ComputeArgMinLayout(shape, ss.GetDimNum(), GroupDim(dims, g), l)) {
+            return ge::GRAPH_FAILED;
+        }
+        inner[g] = static_cast<uint32_t>(l.inner);
+        outer[g] = static_cast<uint32_t>(l.outer);
+        stride_m[g] = static_cast<uint32_t>(l.stride_m);
+        if (l.inner == 0 || l.outer == 0) continue;
+        if (l.stride_m == 1) {
+            slices.push_back({static_cast<uint32_t>(g), l.outer, l.inner + SLICE_OVERHEAD_ELEMS});
+        } else {
+            planes.push_back({static_cast<uint32_t>(g), l.outer / l.stride_m, l.inner * l.stride_m});
+        }
+    }
+    for (const auto *works : {&slices, &planes}) {
+        for (const auto &w : *works) total_cost += w.units * w.unit_cost;
+    }
+
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    uint64_t cores = std::min<uint64_t>(std::max<uint32_t>(1, ascendcPlatform.GetCoreNumAiv()),
+                                        GROUPED_ARG_MIN_MAX_CORES);
+    std::vector<WorkItem> items;
+    uint64_t target = std::max<uint64_t>(1, total_cost / (cores * ITEMS_PER_CORE));
+    BuildItems(slices, planes, target, items);
+    while (items.size() > GROUPED_ARG_MIN_MAX_ITEMS) {
+        target *= 2;
+        BuildItems(slices, planes, target, items);
+    }
+    cores = std::max<uint64_t>(1, std::min<uint64_t>(cores, items.size()));
+
+    uint32_t item_group[GROUPED_ARG_MIN_MAX_ITEMS] = {0};
+    uint32_t item_begin[GROUPED_ARG_MIN_MAX_ITEMS] = {0};
+    uint32_t item_count[GROUPED_ARG_MIN_MAX_ITEMS] = {0};
+    uint32_t core_item_begin[GROUPED_ARG_MIN_MAX_CORES + 1] = {0};
+    uint32_t slice_item_num = 0;
+    for (size_t i = 0; i < items.size(); ++i) {
+        item_group[i] = items[i].group;
+        item_begin[i] = items[i].begin;
+        item_count[i] = items[i].count;
+        if (stride_m[items[i].group] == 1) slice_item_num = static_cast<uint32_t>(i + 1);
+    }
+    // 按代价前缀和连续切分：第 c 个核在累计代价达到 c/cores 时结束
+    uint64_t acc = 0;
+    uint32_t c = 1;
+    for (size_t i = 0; i < items.size() && c < cores; ++i) {
+        acc += items[i].cost;
+        while (c < cores && acc * cores >= c * total_cost) {
+            core_item_begin[c++] = static_cast<uint32_t>(i + 1);
+        }
+    }
+    for (; c <= cores; ++c) core_item_begin[c] = static_cast<uint32_t>(items.size());
+
+    tiling.set_group_num(static_cast<uint32_t>(group_num));
+    tiling.set_item_num(static_cast<uint32_t>(items.size()));
+    tiling.set_slice_item_num(slice_item_num);
+    tiling.set_inner(inner);
+    tiling.set_outer(outer);
+    tiling.set_stride_m(stride_m);
+    tiling.set_item_group(item_group);
+    tiling.set_item_begin(item_begin);
+    tiling.set_item_count(item_count);
+    tiling.set_core_item_begin(core_item_begin);
+    context->SetBlockDim(static_cast<uint32_t>(cores));
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace optiling
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const size_t group_num = context->GetIrInputInstanceInfo(0)->GetInstanceNum();
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    auto *dims = attrs->GetListInt(0);
+    bool keepdim = *attrs->GetAttrPointer<bool>(1);
+    if (dims->GetSize() != 1 && dims->GetSize() != group_num) return GRAPH_FAILED;
+    for (size_t g = 0; g < group_num; ++g) {
+        int64_t dim_attr = dims->GetSize() == 1 ? dims->GetData()[0] : dims->GetData()[g];
+        if (InferReducedShape(*context->GetDynamicInputShape(0, g), *context->GetOutputShape(g),
+                              dim_attr, keepdim) != GRAPH_SUCCESS) {
+            return GRAPH_FAILED;
+        }
+    }
+    return GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    const size_t group_num = context->GetIrInputInstanceInfo(0)->GetInstanceNum();
+    for (size_t g = 0; g < group_num; ++g) {
+        context->SetOutputDataType(g, ge::DT_INT64);
+    }
+    return GRAPH_SUCCESS;
+}
+} // namespace ge
+
+
+namespace ops {
+class GroupedArgMin : public OpDef {
+public:
+    explicit GroupedArgMin(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(DYNAMIC)
+            .DataType({ge::DT_BF16, ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32, ge::DT_INT8, ge::DT_INT64, ge::DT_INT16, ge::DT_UINT8})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(DYNAMIC)
+            .DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64, ge::DT_INT64})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Attr("dims").ListInt();
+        this->Attr("keepdim").AttrType(OPTIONAL).Bool(false);
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend310b");
+
+    }
+};
+
+OP_ADD(GroupedArgMin);
+}
@@ -0,0 +1,23 @@
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+constexpr uint32_t GROUPED_ARG_MIN_MAX_GROUPS = 64;
+constexpr uint32_t GROUPED_ARG_MIN_MAX_ITEMS  = 256;
+constexpr uint32_t GROUPED_ARG_MIN_MAX_CORES  = 64;
+
+BEGIN_TILING_DATA_DEF(GroupedArgMinTilingData)
+  TILING_DATA_FIELD_DEF(uint32_t, group_num);
+  TILING_DATA_FIELD_DEF(uint32_t, item_num);
+  TILING_DATA_FIELD_DEF(uint32_t, slice_item_num);  // 前 slice_item_num 个工作项走连续 slice 路径，其余走平面路径
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 64, inner);   // 每组的轴分解，含义同 ArgMinTilingData
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 64, outer);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 64, stride_m);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 256, item_group);  // 工作项 = 第 item_group 组中 [item_begin, item_begin + item_count) 的 slice/平面
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 256, item_begin);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 256, item_count);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 65, core_item_begin);  // 第 c 个核处理 [core_item_begin[c], core_item_begin[c + 1])
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(GroupedArgMin, GroupedArgMinTilingData)
+}
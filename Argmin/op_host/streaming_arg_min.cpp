@@ -0,0 +1,135 @@
+#include "streaming_arg_min_tiling.h"
+#include "arg_min_layout.h"
+#include "arg_min_infer_shape.h"
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+
+namespace optiling {
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    StreamingArgMinTilingData tiling;
+    const auto &ss = context->GetInputShape(0)->GetStorageShape();
+    int32_t rank = ss.GetDimNum();
+    int64_t dims[gert::Shape::kMaxDimNum];
+    for (int i = 0; i < rank; ++i) {
+        dims[i] = ss.GetDim(i);
+    }
+
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    int64_t dim_attr = *attrs->GetAttrPointer<int>(0);
+    // 长序列的全局偏移可能超过 int32，按 int64 读取
+    int64_t chunk_offset = *attrs->GetAttrPointer<int64_t>(2);
+    if (chunk_offset < 0) return ge::GRAPH_FAILED;
+
+    arg_min_layout::ArgMinLayout layout;
+    if (!arg_min_layout::ComputeArgMinLayout(dims, rank, dim_attr, layout)) return ge::GRAPH_FAILED;
+
+    // 状态与输出逐元素对应
+    if (chunk_offset != 0) {
+        if (static_cast<uint64_t>(context->GetInputShape(1)->GetStorageShape().GetShapeSize()) != layout.outer ||
+            static_cast<uint64_t>(context->GetInputShape(2)->GetStorageShape().GetShapeSize()) != layout.outer) {
+            return ge::GRAPH_FAILED;
+        }
+    }
+
+    uint32_t outer_dims[arg_min_layout::MAX_GROUPS] = {0};
+    uint32_t outer_strides[arg_min_layout::MAX_GROUPS] = {0};
+    uint32_t red_dims[arg_min_layout::MAX_GROUPS] = {0};
+    uint32_t red_strides[arg_min_layout::MAX_GROUPS] = {0};
+    for (uint32_t i = 0; i < layout.outer_rank; ++i) {
+        outer_dims[i] = static_cast<uint32_t>(layout.outer_dims[i]);
+        outer_strides[i] = static_cast<uint32_t>(layout.outer_strides[i]);
+    }
+    for (uint32_t i = 0; i < layout.red_rank; ++i) {
+        red_dims[i] = static_cast<uint32_t>(layout.red_dims[i]);
+        red_strides[i] = static_cast<uint32_t>(layout.red_strides[i]);
+    }
+    tiling.set_inner(static_cast<uint32_t>(layout.inner));
+    tiling.set_outer(static_cast<uint32_t>(layout.outer));
+    tiling.set_stride_m(static_cast<uint32_t>(layout.stride_m));
+    tiling.set_seg_len(static_cast<uint32_t>(layout.seg_len));
+    tiling.set_outer_rank(layout.outer_rank);
+    tiling.set_outer_dims(outer_dims);
+    tiling.set_outer_strides(outer_strides);
+    tiling.set_red_rank(layout.red_rank);
+    tiling.set_red_dims(red_dims);
+    tiling.set_red_strides(red_strides);
+    tiling.set_c0(0);
+    tiling.set_c_valid(0);
+    tiling.set_chunk_offset(chunk_offset);
+    if(layout.stride_m == 1) context->SetTilingKey(1);
+    else context->SetTilingKey(0);
+    context->SetBlockDim(1);
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace optiling
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const gert::RuntimeAttrs *attrs = context->GetAttrs();
+    int64_t dim_attr = *attrs->GetAttrPointer<int>(0);
+    bool keepdim = *attrs->GetAttrPointer<bool>(1);
+    const gert::Shape* in_shape = context->GetInputShape(0);
+    if (InferReducedShape(*in_shape, *context->GetOutputShape(0), dim_attr, keepdim) != GRAPH_SUCCESS) {
+        return GRAPH_FAILED;
+    }
+    return InferReducedShape(*in_shape, *context->GetOutputShape(1), dim_attr, keepdim);
+}
+
+static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    context->SetOutputDataType(0, context->GetInputDataType(0));
+    context->SetOutputDataType(1, ge::DT_INT64);
+    return GRAPH_SUCCESS;
+}
+} // namespace ge
+
+
+namespace ops {
+class StreamingArgMin : public OpDef {
+public:
+    explicit StreamingArgMin(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Input("min_val")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Input("min_idx")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT64})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y_val")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_FLOAT, ge::DT_FLOAT16, ge::DT_INT32})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y_idx")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_INT64, ge::DT_INT64, ge::DT_INT64})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Attr("dim").AttrType(OPTIONAL).Int(255);
+        this->Attr("keepdim").AttrType(OPTIONAL).Bool(false);
+        this->Attr("chunk_offset").AttrType(OPTIONAL).Int(0);
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend310b");
+
+    }
+};
+
+OP_ADD(StreamingArgMin);
+}
@@ -0,0 +1,22 @@
+
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(StreamingArgMinTilingData)
+  TILING_DATA_FIELD_DEF(uint32_t, inner);      // 本块沿被归约轴的长度，轴分解同 ArgMinTilingData
+  TILING_DATA_FIELD_DEF(uint32_t, outer);
+  TILING_DATA_FIELD_DEF(uint32_t, stride_m);
+  TILING_DATA_FIELD_DEF(uint32_t, seg_len);
+  TILING_DATA_FIELD_DEF(uint32_t, outer_rank);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, outer_dims);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, outer_strides);
+  TILING_DATA_FIELD_DEF(uint32_t, red_rank);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, red_dims);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, red_strides);
+  TILING_DATA_FIELD_DEF(uint32_t, c0);         // 只支持 ND，恒为 0
+  TILING_DATA_FIELD_DEF(uint32_t, c_valid);
+  TILING_DATA_FIELD_DEF(int64_t, chunk_offset); // 本块首元素在被归约轴上的全局下标，0 表示第一块
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(StreamingArgMin, StreamingArgMinTilingData)
+}
@@ -0,0 +1,299 @@
+#include "kernel_operator.h"
+#include "kernel_arg_min.h"
+
+/*
+ * ArgMinK：沿 dim 取最小的 k 个元素的下标，按值升序输出，值相同时下标小的在前。
+ * 轴分解与 ArgMin 相同(arg_min_layout.h)，输入只读一遍，不排序，中间结果不回写 GM：
+ *   平面路径(key 0)：每列在 UB 中保存 k 层 (值, 下标)，每读入一行做一次逐层下沉的向量插入
+ *                    (Compare 出 mask，再用 Select 交换当前层与候选)；
+ *   slice 路径(key 1)：每个 tile 反复 ReduceMin 取出候选插入 k 元素标量表，
+ *                    tile 内最小值不再优于第 k 名时立即停止。
+ */
+template <typename T>
+class KernelArgMinK
+{
+public:
+    using ValueT = T;
+    using IndexT = int64_t;
+    using CmpT   = typename CmpType<ValueT>::type;
+    // Select 只支持 half/float，int32 的值按位当作 float 选择
+    using SelT   = std::conditional_t<std::is_same<CmpT, half>::value, half, float>;
+    static_assert(std::is_same<T, half>::value || std::is_same<T, float>::value ||
+                  std::is_same<T, bfloat16_t>::value || std::is_same<T, int32_t>::value,
+                  "KernelArgMinK: only float/half/bfloat16/int32");
+
+    static constexpr uint32_t MAX_K = 16;
+    static constexpr CmpT CmpT_MAX = KernelArgMin<T>::CmpT_MAX;
+
+    __aicore__ KernelArgMinK() = default;
+
+    template <typename TilingT>
+    __aicore__ inline void Init(GM_ADDR x_gm, GM_ADDR y_gm, const TilingT &t, TPipe *pipe_ptr)
+    {
+        pipe      = pipe_ptr;
+        blockIdx  = GetBlockIdx();
+        blockNum  = GetBlockNum();
+        inner     = t.inner;
+        outer     = t.outer;
+        stride_m  = t.stride_m;
+        k         = t.k;
+        tileCol   = t.tile_col;
+        tileInner = t.tile_inner;
+        planes    = outer / stride_m;
+        xGm.SetGlobalBuffer(reinterpret_cast<__gm__ ValueT *>(x_gm), inner * outer);
+        yGm.SetGlobalBuffer(reinterpret_cast<__gm__ IndexT *>(y_gm), outer * k);
+
+        if (TILING_KEY_IS(1)) {
+            pipe->InitBuffer(inSliceQueue, 1, tileInner * sizeof(ValueT) + 32);
+            pipe->InitBuffer(bufWork,         (tileInner / 8 + 256) * sizeof(CmpT));
+            pipe->InitBuffer(bufMinIdx,       32);
+            pipe->InitBuffer(outIdxQueue,  1, MAX_K * sizeof(IndexT));
+        } else if (TILING_KEY_IS(0)) {
+            // 与 host 侧 PlaneBytesPerCol 保持一致
+            pipe->InitBuffer(rowQueue,     2, tileCol * sizeof(ValueT) + 32);
+            if constexpr (std::is_same<ValueT, bfloat16_t>::value) {
+                pipe->InitBuffer(bufRow,      tileCol * sizeof(CmpT) + 32);
+            }
+            pipe->InitBuffer(bufCand,         tileCol * sizeof(CmpT) + 32);
+            pipe->InitBuffer(bufCandIdx,      tileCol * sizeof(int32_t) + 32);
+            pipe->InitBuffer(bufTmpIdx,       tileCol * sizeof(int32_t) + 32);
+            pipe->InitBuffer(bufVals,         k * tileCol * sizeof(CmpT) + 32);
+            pipe->InitBuffer(bufIdx,          k * tileCol * sizeof(int32_t) + 32);
+            pipe->InitBuffer(outIdxQueue,  1, tileCol * sizeof(IndexT) + 32);
+            pipe->InitBuffer(bufcmpMask,      (tileCol + 7) / 8 + 32);
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+        if (TILING_KEY_IS(1)) {
+            for (uint32_t s = blockIdx; s < outer; s += blockNum) {
+                ReduceSlice(s);
+            }
+        } else if (TILING_KEY_IS(0)) {
+            for (uint32_t p = blockIdx; p < planes; p += blockNum) {
+                ReducePlane(p);
+            }
+        }
+    }
+
+private:
+    static constexpr uint32_t VEC_BYTES = 256;
+    __aicore__ static inline uint32_t RoundUpTo(uint32_t n, uint32_t a) { return (n + a - 1) / a * a; }
+    __aicore__ static inline uint32_t CmpAlignedLen(uint32_t len) { return RoundUpTo(len, VEC_BYTES / sizeof(CmpT)); }
+
+    template <HardEvent EVT>
+    __aicore__ inline void WaitEvent()
+    {
+        event_t e = static_cast<event_t>(pipe->FetchEventID(EVT));
+        SetFlag<EVT>(e);
+        WaitFlag<EVT>(e);
+    }
+
+    __aicore__ static inline CmpT ToCmp(ValueT v)
+    {
+        if constexpr (std::is_same<ValueT, bfloat16_t>::value) {
+            return ToFloat(v);
+        } else {
+            return v;
+        }
+    }
+
+    /* 插入有序 k 表；严格小于才前移，保证同值时先到(下标小)的在前 */
+    __aicore__ inline void InsertTopK(CmpT *vals, IndexT *idxs, uint32_t &filled, CmpT v, IndexT i)
+    {
+        if (filled == k && !(v < vals[k - 1])) return;
+        uint32_t pos = filled < k ? filled++ : k - 1;
+        while (pos > 0 && v < vals[pos - 1]) {
+            vals[pos] = vals[pos - 1];
+            idxs[pos] = idxs[pos - 1];
+            --pos;
+        }
+        vals[pos] = v;
+        idxs[pos] = i;
+    }
+
+    /* --- 连续维 --- */
+    __aicore__ inline void SliceCompute(uint32_t baseOffset, uint32_t validLen,
+                                        CmpT *vals, IndexT *idxs, uint32_t &filled)
+    {
+        auto tile = inSliceQueue.DeQue<ValueT>();
+        if constexpr (std::is_same<ValueT, half>::value || std::is_same<ValueT, float>::value) {
+            using IdxIntT = typename KernelArgMin<T>::IdxIntT;
+            auto answer = bufMinIdx.Get<ValueT>();
+            auto work   = bufWork.Get<ValueT>();
+            const uint32_t rounds = min(k, validLen);
+            uint32_t taken[MAX_K];
+            uint32_t nTaken = 0;
+            for (uint32_t n = 0; n < rounds; ++n) {
+                ReduceMin(answer, tile, work, validLen, true);
+                WaitEvent<HardEvent::V_S>();
+                CmpT v = answer.GetValue(0);
+                CmpT rawIdx = answer.GetValue(1);
+                uint32_t li = *reinterpret_cast<IdxIntT *>(&rawIdx);
+                // tile 剩余元素都不可能进入 k 表
+                if (filled == k && !(v < vals[k - 1])) break;
+                if (v == CmpT_MAX) {
+                    // 剩余元素都是 CmpT_MAX(+inf)，与已取出位置的标记无法区分，ReduceMin 可能再次返回已取出的下标；
+                    // 改为按下标顺序标量扫描未取出的位置补满 k 表
+                    for (uint32_t i = 0; i < validLen && filled < k; ++i) {
+                        bool used = false;
+                        for (uint32_t j = 0; j < nTaken; ++j) used = used || taken[j] == i;
+                        if (!used) InsertTopK(vals, idxs, filled, v, baseOffset + i);
+                    }
+                    break;
+                }
+                InsertTopK(vals, idxs, filled, v, baseOffset + li);
+                taken[nTaken++] = li;
+                tile.SetValue(li, CmpT_MAX);
+                WaitEvent<HardEvent::S_V>();
+            }
+        } else {
+            for (uint32_t i = 0; i < validLen; ++i) {
+                InsertTopK(vals, idxs, filled, ToCmp(tile.GetValue(i)), baseOffset + i);
+            }
+        }
+        inSliceQueue.FreeTensor(tile);
+    }
+
+    __aicore__ inline void ReduceSlice(uint32_t slice)
+    {
+        CmpT   vals[MAX_K];
+        IndexT idxs[MAX_K];
+        uint32_t filled = 0;
+        const uint32_t base = slice * inner;
+        uint32_t chunk;
+        for (uint32_t done = 0; done < inner; done += chunk) {
+            chunk = min(tileInner, inner - done);
+            auto t = inSliceQueue.AllocTensor<ValueT>();
+            DataCopyPad(t, xGm[base + done], {1, static_cast<uint32_t>(chunk * sizeof(ValueT)), 0, 0, 0},
+                        {false, 0, 0, 0});
+            inSliceQueue.EnQue(t);
+            SliceCompute(done, chunk, vals, idxs, filled);
+        }
+        // 经 UB 一次写回 k 个下标，避免多核标量写同一 cache line
+        auto out = outIdxQueue.AllocTensor<IndexT>();
+        for (uint32_t j = 0; j < k; ++j) out.SetValue(j, idxs[j]);
+        WaitEvent<HardEvent::S_MTE3>();
+        DataCopyPad(yGm[slice * k], out, {1, static_cast<uint32_t>(k * sizeof(IndexT)), 0, 0, 0});
+        outIdxQueue.FreeTensor(out);
+    }
+
+    /* --- Plane --- */
+    __aicore__ inline void PlaneRowCopyIn(uint32_t gmRowPos, uint32_t validLen)
+    {
+        auto row = rowQueue.AllocTensor<ValueT>();
+        DataCopyPad(row, xGm[gmRowPos], {1, static_cast<uint32_t>(validLen * sizeof(ValueT)), 0, 0, 0},
+                    {false, 0, 0, 0});
+        rowQueue.EnQue(row);
+    }
+
+    /*
+     * 把第 r 行插入 k 层表：候选(cand, candIdx)逐层比较，比当前层小则与之交换，被换下的继续下沉。
+     * 前 min(r, k) 层已填满；r < k 时最后的候选直接落到第 r 层。
+     */
+    __aicore__ inline void PlaneInsertRow(uint32_t r, uint32_t len)
+    {
+        auto row = rowQueue.DeQue<ValueT>();
+        LocalTensor<CmpT> cand;
+        if constexpr (std::is_same<ValueT, bfloat16_t>::value) {
+            cand = bufRow.Get<CmpT>();
+            Cast(cand, row, AscendC::RoundMode::CAST_NONE, len);
+        } else {
+            cand = row;
+        }
+        LocalTensor<CmpT> tmp   = bufCand.Get<CmpT>();
+        LocalTensor<float> candIdx = bufCandIdx.Get<float>();
+        LocalTensor<float> tmpIdx  = bufTmpIdx.Get<float>();
+        auto vals    = bufVals.Get<CmpT>();
+        auto idxs    = bufIdx.Get<float>();
+        auto cmpMask = bufcmpMask.Get<uint8_t>();
+        const uint32_t cmpLen = CmpAlignedLen(len);
+
+        Duplicate(candIdx.ReinterpretCast<int32_t>(), static_cast<int32_t>(r), len);
+        const uint32_t levels = min(r, k);
+        for (uint32_t j = 0; j < levels; ++j) {
+            auto vj = vals[j * tileCol];
+            auto ij = idxs[j * tileCol];
+            // int32 也直接比较，不经差值，避免异号大数相减溢出
+            Compare(cmpMask, cand, vj, AscendC::CMPMODE::LT, cmpLen);
+            // tmp = 被换下的值(候选更小处取原层值)，当前层原地更新
+            Select(tmp.template ReinterpretCast<SelT>(), cmpMask, vj.template ReinterpretCast<SelT>(),
+                   cand.template ReinterpretCast<SelT>(), AscendC::SELMODE::VSEL_TENSOR_TENSOR_MODE, len);
+            Select(vj.template ReinterpretCast<SelT>(), cmpMask, cand.template ReinterpretCast<SelT>(),
+                   vj.template ReinterpretCast<SelT>(), AscendC::SELMODE::VSEL_TENSOR_TENSOR_MODE, len);
+            Select(tmpIdx, cmpMask, ij, candIdx, AscendC::SELMODE::VSEL_TENSOR_TENSOR_MODE, len);
+            Select(ij, cmpMask, candIdx, ij, AscendC::SELMODE::VSEL_TENSOR_TENSOR_MODE, len);
+            // 交换角色，下一层以被换下的元素为候选
+            auto t = cand; cand = tmp; tmp = t;
+            auto ti = candIdx; candIdx = tmpIdx; tmpIdx = ti;
+        }
+        if (r < k) {
+            DataCopy(vals[r * tileCol], cand, cmpLen);
+            DataCopy(idxs[r * tileCol], candIdx, RoundUpTo(len, 64));
+        }
+        rowQueue.FreeTensor(row);
+    }
+
+    __aicore__ inline void PlaneCopyOut(uint32_t plane, uint32_t off, uint32_t len)
+    {
+        auto idxs = bufIdx.Get<int32_t>();
+        for (uint32_t j = 0; j < k; ++j) {
+            auto out = outIdxQueue.AllocTensor<IndexT>();
+            Cast(out, idxs[j * tileCol], AscendC::RoundMode::CAST_NONE, len);
+            outIdxQueue.EnQue(out);
+            out = outIdxQueue.DeQue<IndexT>();
+            DataCopyPad(yGm[(plane * k + j) * stride_m + off], out,
+                        {1, static_cast<uint32_t>(len * sizeof(IndexT)), 0, 0, 0});
+            outIdxQueue.FreeTensor(out);
+        }
+    }
+
+    __aicore__ inline void ReducePlane(uint32_t plane)
+    {
+        const uint32_t planeBase = plane * inner * stride_m;
+        uint32_t len;
+        for (uint32_t off = 0; off < stride_m; off += len) {
+            len = min(tileCol, stride_m - off);
+            PlaneRowCopyIn(planeBase + off, len);
+            for (uint32_t r = 0; r < inner; ++r) {
+                if (r + 1 < inner) {
+                    PlaneRowCopyIn(planeBase + (r + 1) * stride_m + off, len);
+                }
+                PlaneInsertRow(r, len);
+            }
+            PlaneCopyOut(plane, off, len);
+        }
+    }
+
+private:
+    GlobalTensor<ValueT> xGm;
+    GlobalTensor<IndexT> yGm;
+    TPipe *pipe;
+
+    TQue<TPosition::VECIN,  1> inSliceQueue;
+    TQue<TPosition::VECIN,  2> rowQueue;
+    TQue<TPosition::VECOUT, 1> outIdxQueue;
+    TBuf<TPosition::VECCALC> bufWork;     // Slice ReduceMin 工作区，保证 tile 在多轮间不被破坏
+    TBuf<TPosition::VECCALC> bufMinIdx;
+    TBuf<TPosition::VECCALC> bufRow;      // bf16 行提升到 float
+    TBuf<TPosition::VECCALC> bufCand;
+    TBuf<TPosition::VECCALC> bufCandIdx;
+    TBuf<TPosition::VECCALC> bufTmpIdx;
+    TBuf<TPosition::VECCALC> bufVals;     // k 层值，第 j 层从 j*tileCol 开始
+    TBuf<TPosition::VECCALC> bufIdx;      // k 层下标(int32)
+    TBuf<TPosition::VECCALC> bufcmpMask;
+
+    uint32_t inner, outer, stride_m, planes;
+    uint32_t k, tileCol, tileInner;
+    uint32_t blockIdx, blockNum;
+};
+
+extern "C" __global__ __aicore__ void arg_min_k(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    KernelArgMinK<DTYPE_X> op;
+    TPipe pipe;
+    op.Init(x, y, tilingData, &pipe);
+    op.Process();
+}
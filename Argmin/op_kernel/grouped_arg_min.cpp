@@ -0,0 +1,48 @@
+#include "kernel_operator.h"
+#include "kernel_arg_min.h"
+
+/*
+ * 一次 launch 处理一组 tensor 的 ArgMin。
+ * host 把各组按 slice / 平面切成工作项并按代价连续分给各核；
+ * 每个核先处理 slice 类工作项，再重置 UB 切到平面布局处理平面类工作项。
+ */
+extern "C" __global__ __aicore__ void grouped_arg_min(GM_ADDR x, GM_ADDR y,
+                                                      GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    AscendC::ListTensorDesc xList(reinterpret_cast<__gm__ void *>(x));
+    AscendC::ListTensorDesc yList(reinterpret_cast<__gm__ void *>(y));
+    KernelArgMin<DTYPE_X> op;
+    TPipe pipe;
+    op.Setup(&pipe);
+
+    const uint32_t core = GetBlockIdx();
+    const uint32_t begin = tilingData.core_item_begin[core];
+    const uint32_t end = tilingData.core_item_begin[core + 1];
+    const uint32_t mid = begin > tilingData.slice_item_num ? begin
+                       : (end < tilingData.slice_item_num ? end : tilingData.slice_item_num);
+
+    if (begin < mid) {
+        op.InitSliceBuffers();
+        for (uint32_t i = begin; i < mid; ++i) {
+            uint32_t g = tilingData.item_group[i];
+            op.Bind(reinterpret_cast<GM_ADDR>(xList.GetDataPtr<DTYPE_X>(g)),
+                    reinterpret_cast<GM_ADDR>(yList.GetDataPtr<int64_t>(g)),
+                    tilingData.inner[g], tilingData.outer[g], tilingData.stride_m[g]);
+            op.ProcessSlices(tilingData.item_begin[i], tilingData.item_begin[i] + tilingData.item_count[i]);
+        }
+    }
+    if (mid < end) {
+        if (begin < mid) {
+            pipe.Reset();
+        }
+        op.InitPlaneBuffers();
+        for (uint32_t i = mid; i < end; ++i) {
+            uint32_t g = tilingData.item_group[i];
+            op.Bind(reinterpret_cast<GM_ADDR>(xList.GetDataPtr<DTYPE_X>(g)),
+                    reinterpret_cast<GM_ADDR>(yList.GetDataPtr<int64_t>(g)),
+                    tilingData.inner[g], tilingData.outer[g], tilingData.stride_m[g]);
+            op.ProcessPlanes(tilingData.item_begin[i], tilingData.item_begin[i] + tilingData.item_count[i]);
+        }
+    }
+}
@@ -0,0 +1,924 @@
+
+
+#ifndef KERNEL_ARG_MIN_H
+#define KERNEL_ARG_MIN_H
+#include "kernel_operator.h"
+#include <limits>
+#include <type_traits>
+#include <utility>
+using namespace AscendC;
+
+/* 数值比较类型映射：bfloat16 在向量比较/计算阶段提升到 float */
+template <typename T>
+struct CmpType { using type = T; };
+template <> struct CmpType<bfloat16_t> { using type = float; };
+
+/* 支持类型集合 */
+template <typename T> struct IsArgMinSupported : std::false_type {};
+template <> struct IsArgMinSupported<half>       : std::true_type {};
+template <> struct IsArgMinSupported<bfloat16_t> : std::true_type {};
+template <> struct IsArgMinSupported<float>      : std::true_type {};
+template <> struct IsArgMinSupported<int8_t>     : std::true_type {};
+template <> struct IsArgMinSupported<uint8_t>    : std::true_type {};
+template <> struct IsArgMinSupported<int16_t>    : std::true_type {};
+template <> struct IsArgMinSupported<int32_t>    : std::true_type {};
+template <> struct IsArgMinSupported<int64_t>    : std::true_type {};
+
+/* IdxT 为输出下标类型：int64 或 int32(归约长度 < 2^31 时由 dtype 属性选择) */
+template <typename T, typename IdxT = int64_t>
+class KernelArgMin
+{
+public:
+    using ValueT = T;
+    using IndexT = IdxT;
+    using CmpT   = typename CmpType<ValueT>::type;
+    static_assert(IsArgMinSupported<T>::value,
+                  "KernelArgMin: only float/half/bfloat16/int8/uint8/int16/int32/int64");
+    static_assert(std::is_same<IdxT, int64_t>::value || std::is_same<IdxT, int32_t>::value,
+                  "KernelArgMin: index output must be int64 or int32");
+
+    static constexpr int32_t ALIGNED = 32 / sizeof(ValueT);
+
+    // 与 CmpT 等长的无符号整型，用于 reinterpret 索引
+    using IdxIntT =
+        std::conditional_t<sizeof(CmpT) == 1, uint8_t,
+        std::conditional_t<sizeof(CmpT) == 2, uint16_t,
+        std::conditional_t<sizeof(CmpT) == 4, uint32_t,
+        std::conditional_t<sizeof(CmpT) == 8, uint64_t, void>>>>;
+
+    static constexpr CmpT CmpT_MAX =
+        (std::numeric_limits<CmpT>::has_infinity
+             ? std::numeric_limits<CmpT>::infinity()
+             : std::numeric_limits<CmpT>::max());
+
+    // 掩码 Select 按位宽 reinterpret：2B 走 half，4B(float/int32) 走 float
+    using SelT = std::conditional_t<sizeof(CmpT) == 2, half, float>;
+
+    __aicore__ KernelArgMin() = default;
+
+    template <typename TilingT>
+    __aicore__ inline void Init(GM_ADDR x_gm, GM_ADDR mask_gm, GM_ADDR out_idx_gm, GM_ADDR,
+                                const TilingT &t, TPipe *pipe_ptr)
+    {
+        Setup(pipe_ptr);
+        Bind(x_gm, out_idx_gm, t.inner, t.outer, t.stride_m);
+        BindGroups(t);
+        if (t.has_mask) {
+            BindMask(mask_gm, t.mask_bitpacked != 0, t.masked_index);
+        }
+
+        xGm.SetGlobalBuffer(reinterpret_cast<__gm__ uint64_t *>(x_gm), totalSize);
+        DataCachePreload(xGm, int64_t(0));
+
+        if (TILING_KEY_IS(1)) {
+            InitSliceBuffers();
+        } else if (TILING_KEY_IS(0)) {
+            InitPlaneBuffers();
+        } else if (TILING_KEY_IS(2)) {
+            Bind5Hd(t.c0, t.c_valid);
+            InitPlaneBuffers();
+        }
+    }
+
+    /*
+     * 流式变体：x 是沿被归约轴的一个分块，min_val/min_idx 是此前各块的结果，
+     * 本块下标加上 chunk_offset 成为全局下标后与之合并，写出 y_val/y_idx。
+     * chunk_offset == 0 表示第一块，忽略输入状态。分块需按顺序到达，同值时保留先前状态。
+     */
+    template <typename TilingT>
+    __aicore__ inline void InitStreaming(GM_ADDR x_gm, GM_ADDR min_val_gm, GM_ADDR min_idx_gm,
+                                         GM_ADDR y_val_gm, GM_ADDR y_idx_gm,
+                                         const TilingT &t, TPipe *pipe_ptr)
+    {
+        Setup(pipe_ptr);
+        Bind(x_gm, y_idx_gm, t.inner, t.outer, t.stride_m);
+        BindGroups(t);
+        streaming   = true;
+        chunkOffset = t.chunk_offset;
+        hasState    = t.chunk_offset != 0;
+        stateValGm.SetGlobalBuffer(reinterpret_cast<__gm__ ValueT *>(min_val_gm), outer);
+        stateIdxGm.SetGlobalBuffer(reinterpret_cast<__gm__ IndexT *>(min_idx_gm), outer);
+        outValGm.SetGlobalBuffer(reinterpret_cast<__gm__ ValueT *>(y_val_gm), outer);
+        // 状态读写缓冲占用额外 UB，列块减半
+        colTile = TILE_COL / 2;
+
+        if (TILING_KEY_IS(1)) {
+            InitSliceBuffers();
+        } else if (TILING_KEY_IS(0)) {
+            InitPlaneBuffers();
+            pipe->InitBuffer(bufStateVal, colTile * sizeof(ValueT) + 32);
+            pipe->InitBuffer(bufStateIdx, colTile * sizeof(IndexT) + 32);
+            if constexpr (sizeof(IndexT) == 8) {
+                pipe->InitBuffer(bufStateSel, colTile * sizeof(IndexT) + 32);  // int64 下标的按位选择掩码
+            }
+        }
+    }
+
+    __aicore__ inline void Setup(TPipe *pipe_ptr)
+    {
+        blockIdx  = GetBlockIdx();
+        blockNum  = GetBlockNum();
+        pipe      = pipe_ptr;
+        colTile   = TILE_COL;
+    }
+
+    /* 绑定一次归约的输入/输出与轴分解；分组等变体在同一次 launch 内多次调用 */
+    __aicore__ inline void Bind(GM_ADDR x_gm, GM_ADDR out_idx_gm,
+                                uint32_t inner_, uint32_t outer_, uint32_t stride_m_)
+    {
+        inner     = inner_;
+        outer     = outer_;
+        totalSize = inner_ * outer_;
+        stride_m  = stride_m_;
+        stride    = inner * stride_m;
+        planes    = outer / stride_m;
+        inner_last= inner - 1;
+        xxGm.SetGlobalBuffer(reinterpret_cast<__gm__ ValueT *>(x_gm), totalSize);
+        outGm.SetGlobalBuffer(reinterpret_cast<__gm__ IndexT*>(out_idx_gm), outer);
+        // 单轴分解：slice/平面按编号等距排列，行间隔 stride_m
+        segLen = stride_m == 1 ? inner : 1;
+        outerRank = 1;
+        outerDims[0] = stride_m == 1 ? outer : planes;
+        outerStrides[0] = stride;
+        redRank = stride_m == 1 ? 0 : 1;
+        redDims[0] = inner;
+        redStrides[0] = stride_m;
+    }
+
+    /*
+     * NC1HWC0 沿 C 归约：按 [N, C1, H*W*C0] 走平面路径(每行一个 C1)，
+     * 最后一个 C1 行中 >= c_valid 的 C0 填充通道先置为最大值，再在块内折叠 C0。
+     */
+    __aicore__ inline void Bind5Hd(uint32_t c0_, uint32_t c_valid_)
+    {
+        c0 = c0_;
+        const uint32_t validLast = c_valid_ - (inner - 1) * c0;
+        padMask[0] = 0;
+        padMask[1] = 0;
+        for (uint32_t i = 0; i < VecElems(); ++i) {
+            if (i % c0 >= validLast) padMask[i / 64] |= (uint64_t(1) << (i % 64));
+        }
+        hasPad = validLast < c0;
+    }
+
+    /*
+     * 可选掩码：为真(位打包时对应位为 1)的元素才参与比较，其余在 UB 中 Select 成 CmpT_MAX，
+     * 被屏蔽后的张量不落 GM。一个输出的所有元素都被屏蔽时写 masked_index。
+     * 位打包按展平下标 LSB 在前，每行/段起点是 8 的倍数(host 保证)。
+     */
+    __aicore__ inline void BindMask(GM_ADDR mask_gm, bool packed, int32_t sentinel)
+    {
+        hasMask     = true;
+        maskPacked  = packed;
+        maskedIndex = sentinel;
+        maskGm.SetGlobalBuffer(reinterpret_cast<__gm__ uint8_t *>(mask_gm), packed ? (totalSize + 7) / 8 : totalSize);
+        // 掩码行、位图与有效标记占用额外 UB，列块减半
+        colTile = TILE_COL / 2;
+    }
+
+    /* 多轴归约：用 tiling 中的混合进制展开覆盖单轴分解(见 arg_min_layout.h) */
+    template <typename TilingT>
+    __aicore__ inline void BindGroups(const TilingT &t)
+    {
+        segLen = t.seg_len;
+        outerRank = t.outer_rank;
+        redRank = t.red_rank;
+        for (uint32_t i = 0; i < MAX_GROUPS; ++i) {
+            outerDims[i] = t.outer_dims[i];
+            outerStrides[i] = t.outer_strides[i];
+            redDims[i] = t.red_dims[i];
+            redStrides[i] = t.red_strides[i];
+        }
+    }
+
+    __aicore__ inline void InitSliceBuffers()
+    {
+        // Slice 单流水：深度=1
+        pipe->InitBuffer(inSliceQueue, 1, (TILE_INNER) * sizeof(ValueT) + 32);
+        pipe->InitBuffer(bufMinIdx,    32);
+        // 结果先攒在 UB，每批一次 DataCopyPad 写回
+        pipe->InitBuffer(bufSliceIdx,  SLICE_OUT_BATCH * sizeof(IndexT));
+        if (streaming) {
+            pipe->InitBuffer(bufSliceVal, SLICE_OUT_BATCH * sizeof(ValueT));
+        }
+        if (hasMask) {
+            InitMaskBuffers(1, TILE_INNER);
+        }
+    }
+
+    __aicore__ inline void InitMaskBuffers(int32_t depth, uint32_t cols)
+    {
+        pipe->InitBuffer(maskQueue, depth, (maskPacked ? cols / 8 : cols) + 32);
+        if (!maskPacked) {
+            pipe->InitBuffer(bufMaskHalf, cols * sizeof(half) + 32);
+        }
+        pipe->InitBuffer(bufSelMask, cols / 8 + 32);
+    }
+
+    __aicore__ inline void InitPlaneBuffers()
+    {
+        // 平面路径：行读取双缓冲；写回用 VECOUT 双缓冲
+        pipe->InitBuffer(rowQueue,     2, (colTile) * sizeof(ValueT)    + 32);
+        pipe->InitBuffer(bufcmpMask,      (colTile + 7) / 8           + 32);
+        if constexpr (std::is_same<ValueT, bfloat16_t>::value) {
+            pipe->InitBuffer(bufRow,      (colTile) * sizeof(CmpT) + 32);
+        }
+        if constexpr (sizeof(IndexT) == 4) {
+            // int32 下标：索引直接在写回缓冲中累积，无需 int64 Cast；最小值单独分配
+            pipe->InitBuffer(bufCastVals, (colTile) * sizeof(CmpT) + 32);
+            pipe->InitBuffer(outIdxQueue, 1, (colTile) * sizeof(IndexT) + 32);
+        } else {
+            pipe->InitBuffer(bufCastIdx,  (colTile) * sizeof(int32_t)   + 32);
+            pipe->InitBuffer(outIdxQueue, 1, (colTile) * sizeof(IndexT) + 256);
+        }
+        if (hasMask) {
+            // 掩码行与数据行同步双缓冲；每列一个 half 记录是否见过有效元素
+            InitMaskBuffers(2, colTile);
+            pipe->InitBuffer(bufOnes,     (colTile) * sizeof(half) + 32);
+            pipe->InitBuffer(bufAnyValid, (colTile) * sizeof(half) + 32);
+            pipe->InitBuffer(bufFirstValid, (colTile) / 8 + 32);
+            Duplicate(bufOnes.Get<half>(), static_cast<half>(1), colTile);
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+
+        
+        if (TILING_KEY_IS(1)) {
+            // slice 按核连续切分，相邻输出尽量由同一核在一次写回中写出
+            const uint32_t per = (outer + blockNum - 1) / blockNum;
+            const uint32_t begin = min(outer, blockIdx * per);
+            ProcessSlices(begin, min(outer, begin + per));
+        } else if (TILING_KEY_IS(0) || TILING_KEY_IS(2)) {
+            for (uint32_t p = blockIdx; p < planes; p += blockNum) {
+                ReducePlane(p);
+            }
+        }
+    }
+
+    /*
+     * 处理当前绑定下 [begin, end) 的连续 slice / 平面，供按工作项调度的变体使用。
+     * 相邻 slice 的输出可能属于其他核，同一 cache line 上的标量写回会互相覆盖：
+     * 每批至多 SLICE_OUT_BATCH 个结果攒在 UB 中，用一次 DataCopyPad 精确写回
+     */
+    __aicore__ inline void ProcessSlices(uint32_t begin, uint32_t end)
+    {
+        uint32_t n;
+        for (uint32_t s = begin; s < end; s += n) {
+            n = min(SLICE_OUT_BATCH, end - s);
+            for (uint32_t i = 0; i < n; ++i) {
+                ReduceContiguousSlice(s + i, i);
+            }
+            SliceCopyOut(s, n);
+        }
+    }
+
+    __aicore__ inline void ProcessPlanes(uint32_t begin, uint32_t end)
+    {
+        for (uint32_t p = begin; p < end; ++p) {
+            ReducePlane(p);
+        }
+    }
+
+private:
+    /* -------- 工具函数 -------- */
+    static constexpr uint32_t VEC_BYTES = 256;
+
+    __aicore__ static inline uint32_t Align32Elems(uint32_t len)
+    {
+        return (len + ALIGNED - 1) & ~(ALIGNED - 1);
+    }
+    __aicore__ static inline uint32_t VecElems() { return VEC_BYTES / sizeof(CmpT); }
+    __aicore__ static inline uint32_t RoundUpTo(uint32_t n, uint32_t a) { return (n + a - 1) / a * a; }
+    __aicore__ static inline uint32_t CmpAlignedLen(uint32_t len) { return RoundUpTo(len, VecElems()); }
+    __aicore__ static inline uint32_t Align8Elems(uint32_t len) { return RoundUpTo(len, 8); }
+
+    /* 编号 n 按 dims(高维在前)展开成元素偏移 */
+    __aicore__ static inline uint32_t MixedOffset(uint32_t n, uint32_t rank,
+                                                  const uint32_t *dims, const uint32_t *strides)
+    {
+        if (rank == 1) return n * strides[0];
+        uint32_t off = 0;
+        for (int32_t i = static_cast<int32_t>(rank) - 1; i >= 0; --i) {
+            off += (n % dims[i]) * strides[i];
+            n /= dims[i];
+        }
+        return off;
+    }
+
+    /* --- 连续维: copyin / compute / copyout --- */
+    __aicore__ inline void SliceCopyIn(uint32_t gmPos, uint32_t validLen)
+    {
+        auto t = inSliceQueue.AllocTensor<ValueT>();
+        uint32_t alignedLen = Align32Elems(validLen);
+        DataCopy(t, xxGm[gmPos], alignedLen);
+        inSliceQueue.EnQue(t);
+        if (hasMask) {
+            MaskCopyIn(gmPos, validLen);
+        }
+    }
+
+    __aicore__ inline void SliceCompute(uint32_t baseOffset,
+                                        uint32_t validLen,
+                                        CmpT &gMin,
+                                        IndexT &gIdx)
+    {
+        auto tile    = inSliceQueue.DeQue<ValueT>();
+        auto answer  = bufMinIdx.Get<ValueT>();
+        LocalTensor<uint8_t> mask;
+        if (hasMask) {
+            mask = maskQueue.DeQue<uint8_t>();
+            // 第一个有效元素作为初值：被屏蔽的 CmpT_MAX 不能靠 gIdx 的初值 0 或与有效 +inf 持平而胜出
+            if (!sliceAny) {
+                const uint32_t first = MaskFirst(mask, validLen);
+                if (first < validLen) {
+                    sliceAny = true;
+                    if constexpr (std::is_same<ValueT, bfloat16_t>::value) {
+                        gMin = ToFloat(tile.GetValue(first));
+                    } else {
+                        gMin = static_cast<CmpT>(tile.GetValue(first));
+                    }
+                    gIdx = baseOffset + first;
+                }
+            }
+        }
+
+        if constexpr (std::is_same<ValueT, half>::value ||
+                      std::is_same<ValueT, float>::value)
+        {
+            if (hasMask) {
+                auto bits = MaskToBits(mask, validLen);
+                ApplyMask(tile, bits, validLen);
+            }
+            ReduceMin(answer, tile, tile, validLen, true);
+            if (static_cast<float>(answer.GetValue(0)) < static_cast<float>(gMin)) {
+                gMin = answer.GetValue(0);
+                CmpT idx = answer.GetValue(1);
+                gIdx = baseOffset + *reinterpret_cast<IdxIntT*>(&idx);
+            }
+        }
+        else if constexpr (std::is_same<ValueT, bfloat16_t>::value)
+        {
+            // 保持现状（按需求未实现该路径）
+        }
+        else
+        {
+            for (uint32_t i = 0; i < validLen; ++i) {
+                if (hasMask && !MaskBit(mask, i)) continue;
+                if (tile.GetValue(i) < gMin) {
+                    gMin = tile.GetValue(i);
+                    gIdx = baseOffset + i;
+                }
+            }
+        }
+        if (hasMask) {
+            maskQueue.FreeTensor(mask);
+        }
+        inSliceQueue.FreeTensor(tile);
+    }
+
+    __aicore__ static inline bool Less(CmpT a, CmpT b)
+    {
+        if constexpr (std::is_same<CmpT, half>::value) {
+            return static_cast<float>(a) < static_cast<float>(b);
+        } else {
+            return a < b;
+        }
+    }
+
+    /* 第 outPos 个输出的结果放到本批第 slot 个位置 */
+    __aicore__ inline void SliceStage(uint32_t slot, uint32_t outPos, IndexT idxVal, CmpT minVal)
+    {
+        auto idxs = bufSliceIdx.Get<IndexT>();
+        // 流式变体只支持比较类型与存储类型相同的 dtype
+        if constexpr (std::is_same<ValueT, CmpT>::value) {
+            if (streaming) {
+                IndexT g = chunkOffset + idxVal;
+                if (hasState) {
+                    CmpT sv = stateValGm.GetValue(outPos);
+                    if (!Less(minVal, sv)) {
+                        minVal = sv;
+                        g = stateIdxGm.GetValue(outPos);
+                    }
+                }
+                bufSliceVal.Get<ValueT>().SetValue(slot, minVal);
+                idxs.SetValue(slot, g);
+                return;
+            }
+        }
+        idxs.SetValue(slot, idxVal);
+    }
+
+    __aicore__ inline void SliceCopyOut(uint32_t outPos, uint32_t n)
+    {
+        WaitEvent<HardEvent::S_MTE3>();
+        DataCopyPad(outGm[outPos], bufSliceIdx.Get<IndexT>(),
+                    {1, static_cast<uint32_t>(n * sizeof(IndexT)), 0, 0, 0});
+        if (streaming) {
+            DataCopyPad(outValGm[outPos], bufSliceVal.Get<ValueT>(),
+                        {1, static_cast<uint32_t>(n * sizeof(ValueT)), 0, 0, 0});
+        }
+        WaitEvent<HardEvent::MTE3_S>();  // 下一批写暂存前等本批写出完成
+    }
+
+    __aicore__ inline void ReduceContiguousSlice(uint32_t slice, uint32_t slot)
+    {
+        uint32_t base = MixedOffset(slice, outerRank, outerDims, outerStrides);
+        CmpT    gMin = CmpT_MAX;
+        IndexT  gIdx = 0;
+        sliceAny = !hasMask;
+
+        // 多轴时一个输出由 inner / segLen 段连续元素组成，第 q 段的展平下标从 q * segLen 开始
+        const uint32_t segs = segLen == 0 ? 0 : inner / segLen;
+        for (uint32_t q = 0; q < segs; ++q) {
+            const uint32_t segBase = base + MixedOffset(q, redRank, redDims, redStrides);
+            uint32_t chunk;
+            for (uint32_t done = 0; done < segLen; done += chunk) {
+                chunk = min(TILE_INNER, segLen - done);
+                SliceCopyIn(segBase + done, chunk);
+                SliceCompute(q * segLen + done, chunk, gMin, gIdx);
+            }
+        }
+        SliceStage(slot, slice, sliceAny ? gIdx : static_cast<IndexT>(maskedIndex), gMin);
+    }
+
+
+
+    /* --- Plane: 行 copyin / 行 compute / 块 copyout（双缓冲流水） --- */
+    // 第 r 行(归约子空间内展平下标为 r)相对平面起点的偏移
+    __aicore__ inline uint32_t RowOffset(uint32_t r) const
+    {
+        return MixedOffset(r, redRank, redDims, redStrides);
+    }
+
+    __aicore__ inline void PlaneRowCopyIn(const uint32_t &gmRowPos, const uint32_t &validLen)
+    {
+        auto row = rowQueue.AllocTensor<ValueT>();
+        uint32_t alignedLen = Align32Elems(validLen);
+        DataCopy(row, xxGm[gmRowPos], alignedLen);       // 提交 MTE2
+        rowQueue.EnQue(row);
+        if (hasMask) {
+            MaskCopyIn(gmRowPos, validLen);
+        }
+    }
+
+    /* --- 可选掩码 --- */
+    __aicore__ inline void MaskCopyIn(uint32_t gmPos, uint32_t validLen)
+    {
+        auto m = maskQueue.AllocTensor<uint8_t>();
+        const uint32_t bytes = maskPacked ? (validLen + 7) / 8 : validLen;
+        DataCopyPad(m, maskGm[maskPacked ? gmPos / 8 : gmPos], {1, bytes, 0, 0, 0}, {false, 0, 0, 0});
+        maskQueue.EnQue(m);
+    }
+
+    __aicore__ inline bool MaskBit(LocalTensor<uint8_t> &m, uint32_t i)
+    {
+        return maskPacked ? ((m.GetValue(i / 8) >> (i % 8)) & 1) != 0 : m.GetValue(i) != 0;
+    }
+
+    /* 标量扫描到第一个有效元素即返回其位置，整段被屏蔽时返回 len */
+    __aicore__ inline uint32_t MaskFirst(LocalTensor<uint8_t> &m, uint32_t len)
+    {
+        uint32_t i = 0;
+        if (maskPacked) {
+            while (i + 8 <= len && m.GetValue(i / 8) == 0) i += 8;
+        }
+        for (; i < len; ++i) {
+            if (MaskBit(m, i)) return i;
+        }
+        return len;
+    }
+
+    /* bool 掩码经 half 比较成 Select 用的位图；位打包输入本身就是位图 */
+    __aicore__ inline LocalTensor<uint8_t> MaskToBits(LocalTensor<uint8_t> &m, uint32_t len)
+    {
+        if (maskPacked) return m;
+        auto mh   = bufMaskHalf.Get<half>();
+        auto bits = bufSelMask.Get<uint8_t>();
+        Cast(mh, m, AscendC::RoundMode::CAST_NONE, len);
+        CompareScalar(bits, mh, static_cast<half>(0), AscendC::CMPMODE::NE, RoundUpTo(len, VEC_BYTES / sizeof(half)));
+        return bits;
+    }
+
+    /* 被屏蔽的元素置为 CmpT_MAX，之后的比较/归约不会选中它 */
+    __aicore__ inline void ApplyMask(LocalTensor<CmpT> &vals, LocalTensor<uint8_t> &bits, uint32_t len)
+    {
+        if constexpr (std::is_same<CmpT, half>::value || std::is_same<CmpT, float>::value ||
+                      std::is_same<CmpT, int32_t>::value) {
+            CmpT mx = CmpT_MAX;
+            auto v = vals.template ReinterpretCast<SelT>();
+            Select(v, bits, v, *reinterpret_cast<SelT *>(&mx), AscendC::SELMODE::VSEL_TENSOR_SCALAR_MODE, len);
+        }
+    }
+
+    /* 平面路径：取出本行掩码并屏蔽数据，返回有效位图；rowMask 在 PlaneMaskKeep 之后释放 */
+    __aicore__ inline LocalTensor<uint8_t> PlaneApplyMask(LocalTensor<CmpT> &vals, const uint32_t &len)
+    {
+        rowMask   = maskQueue.DeQue<uint8_t>();
+        auto bits = MaskToBits(rowMask, len);
+        ApplyMask(vals, bits, len);
+        return bits;
+    }
+
+    /* 首行：初值本身就是第 0 行，只记录每列是否有效 */
+    __aicore__ inline void PlaneInitMask(LocalTensor<CmpT> &vals, const uint32_t &len)
+    {
+        auto bits = PlaneApplyMask(vals, len);
+        auto any  = bufAnyValid.Get<half>();
+        Duplicate(any, static_cast<half>(0), len);
+        Select(any, bits, bufOnes.Get<half>(), any, AscendC::SELMODE::VSEL_TENSOR_TENSOR_MODE, len);
+        maskQueue.FreeTensor(rowMask);
+    }
+
+    /*
+     * keep 为 1 的列保留原下标。本行有效而该列此前全被屏蔽时必须取本行：
+     * 初值里的 CmpT_MAX 来自被屏蔽元素，与有效的 +inf/最大值持平时不能保住它的下标。
+     * 随后把本行有效位并入 anyValid 并释放本行掩码。
+     */
+    __aicore__ inline void PlaneMaskKeep(LocalTensor<uint8_t> &keep, LocalTensor<uint8_t> &bits,
+                                         const uint32_t &len, const uint32_t &cmpLen)
+    {
+        auto any   = bufAnyValid.Get<half>();
+        auto first = bufFirstValid.Get<uint8_t>();
+        const uint32_t words = cmpLen / 16;  // cmpLen 个比较位按 uint16 处理
+        auto first16 = first.ReinterpretCast<uint16_t>();
+        CompareScalar(first, any, static_cast<half>(0.5), AscendC::CMPMODE::LT, RoundUpTo(len, VEC_BYTES / sizeof(half)));
+        And(first16, first16, bits.ReinterpretCast<uint16_t>(), words);
+        Not(first16, first16, words);
+        And(keep.ReinterpretCast<uint16_t>(), keep.ReinterpretCast<uint16_t>(), first16, words);
+        Select(any, bits, bufOnes.Get<half>(), any, AscendC::SELMODE::VSEL_TENSOR_TENSOR_MODE, len);
+        maskQueue.FreeTensor(rowMask);
+    }
+
+    /* 整列都被屏蔽的输出写 masked_index */
+    __aicore__ inline void PlaneApplySentinel(LocalTensor<float> &CastIdx, const uint32_t &len)
+    {
+        auto cmpMask = bufcmpMask.Get<uint8_t>();
+        int32_t s = maskedIndex;
+        CompareScalar(cmpMask, bufAnyValid.Get<half>(), static_cast<half>(0.5), AscendC::CMPMODE::GE,
+                      RoundUpTo(len, VEC_BYTES / sizeof(half)));
+        Select(CastIdx, cmpMask, CastIdx, *reinterpret_cast<float *>(&s), AscendC::SELMODE::VSEL_TENSOR_SCALAR_MODE, len);
+    }
+
+    /* 5HD 最后一个 C1 行：填充的 C0 通道置为最大值，不参与比较 */
+    __aicore__ inline void MaskPadLanes(LocalTensor<CmpT> &vals, const uint32_t &len)
+    {
+        if constexpr (std::is_same<CmpT, half>::value || std::is_same<CmpT, float>::value) {
+            Duplicate(vals, CmpT_MAX, padMask, static_cast<uint8_t>((len + VecElems() - 1) / VecElems()), 1, 8);
+        }
+    }
+
+    __aicore__ inline void PlaneInit(LocalTensor<CmpT>   &minVals,
+                                     LocalTensor<float> &CastIdx,
+                                     const uint32_t &len,
+                                     bool maskPad = false)
+    {
+        auto row = rowQueue.DeQue<ValueT>();
+        if constexpr (std::is_same<ValueT, bfloat16_t>::value) {
+            Cast(minVals,row,AscendC::RoundMode::CAST_NONE,len);//需要cast
+        }else {
+            DataCopy(minVals,row,Align32Elems(len));//直接拷贝
+        }
+        if (maskPad) {
+            MaskPadLanes(minVals, len);
+        }
+        if (hasMask) {
+            PlaneInitMask(minVals, len);
+        }
+        // 初始化索引缓存为 0
+        AscendC::Duplicate(CastIdx.ReinterpretCast<int32_t>(),0,len);
+        rowQueue.FreeTensor(row);
+    }
+
+    __aicore__ inline void PlaneComputeRow(LocalTensor<CmpT> &minVals,
+                                           LocalTensor<float> &CastIdx,
+                                           const uint32_t &len,
+                                           const float &r,//r实际上是整数
+                                           bool maskPad = false)
+    {
+        LocalTensor<ValueT> row = rowQueue.DeQue<ValueT>();
+        LocalTensor<CmpT> bufrow;
+        const uint32_t cmpLen = CmpAlignedLen(static_cast<uint32_t>(len));
+        auto cmpMask = bufcmpMask.Get<uint8_t>();
+        if constexpr (std::is_same<ValueT, bfloat16_t>::value) {
+            bufrow = bufRow.Get<CmpT>();
+            Cast(bufrow,row,AscendC::RoundMode::CAST_NONE,len);//把row cast 到bufrow
+        }else bufrow = row;//否则直接引用row
+        if (maskPad) {
+            MaskPadLanes(bufrow, len);
+        }
+        LocalTensor<uint8_t> bits;
+        if (hasMask) {
+            bits = PlaneApplyMask(bufrow, len);
+        }
+
+        if constexpr (std::is_same<CmpT, half>::value ||
+                      std::is_same<CmpT, float>::value)
+        {
+            Compare(cmpMask, bufrow, minVals, AscendC::CMPMODE::GE, cmpLen);
+        }
+        else if constexpr (std::is_same<CmpT, int32_t>::value)
+        {
+            // 直接比较：bufrow - minVals 在异号大数时溢出，符号不可靠
+            Compare(cmpMask, bufrow, minVals, AscendC::CMPMODE::LT, cmpLen);
+            Not(cmpMask.ReinterpretCast<uint16_t>(), cmpMask.ReinterpretCast<uint16_t>(), cmpLen / 16);
+        }
+        if (hasMask) {
+            PlaneMaskKeep(cmpMask, bits, len, cmpLen);
+        }
+        if constexpr (std::is_same<CmpT, half>::value || std::is_same<CmpT, float>::value ||
+                      std::is_same<CmpT, int32_t>::value)
+        {
+            Select(CastIdx, cmpMask, CastIdx, r,AscendC::SELMODE::VSEL_TENSOR_SCALAR_MODE, len);
+            Min(minVals, bufrow, minVals, len);
+        }
+        rowQueue.FreeTensor(row);
+    }
+    /*
+     * 平面按编号在核间分配(分组变体按工作项)，相邻平面的输出可能属于其他核：
+     * 列按 colTile 分块走完整个 stride_m，写回用 DataCopyPad 精确写本块的下标，不越过本平面
+     */
+    __aicore__ inline void ReducePlane(const uint32_t &plane)
+    {
+        const uint32_t planeBase = MixedOffset(plane, outerRank, outerDims, outerStrides);
+        uint32_t chunk;
+        for (uint32_t off = 0; off < stride_m; off += chunk) {
+            chunk = min(colTile, stride_m - off);
+            // 5HD 每 C0 列折叠成一个输出；colTile 是 C0 的整数倍
+            const uint32_t outPos = c0 == 0 ? plane * stride_m + off : (plane * stride_m + off) / c0;
+            ReducePlaneColumns(planeBase + off, outPos, chunk);
+        }
+    }
+
+    /* 平面内 [off, off+chunk) 列：逐行更新最小值与行号，最后一次写回 chunk 个下标 */
+    __aicore__ inline void ReducePlaneColumns(uint32_t inBase, uint32_t outPos, uint32_t chunk)
+    {
+        PlaneRowCopyIn(inBase, chunk);
+        auto minIdx = outIdxQueue.AllocTensor<IndexT>();
+        LocalTensor<float> CastIdx;
+        LocalTensor<CmpT> minVals;
+        if constexpr (sizeof(IndexT) == 4) {
+            CastIdx = minIdx.template ReinterpretCast<float>();
+            minVals = bufCastVals.Get<CmpT>();
+        } else {
+            CastIdx = bufCastIdx.Get<float>();
+            minVals = minIdx.template ReinterpretCast<CmpT>();//因为minIdx只会在最后cast时用到,先把他当minVals复用
+        }
+
+        const bool pad = hasPad && c0 != 0;
+        PlaneInit(minVals,CastIdx,chunk, pad && inner == 1);
+
+        if (inner > 1) {
+            PlaneRowCopyIn(inBase + RowOffset(1), chunk);
+        }
+        for (uint32_t r = 1; r + 1 < inner; ++r)
+        {
+            PlaneRowCopyIn(inBase + RowOffset(r + 1), chunk);
+            PlaneComputeRow(minVals,CastIdx,chunk, *reinterpret_cast<float*>(&r));
+        }
+
+        if (inner > 1) {
+            PlaneComputeRow(minVals,CastIdx,chunk, *reinterpret_cast<float*>(&inner_last), pad);
+        }
+
+        if constexpr (std::is_same<ValueT, CmpT>::value) {
+            if (streaming) {
+                MergePlaneState(minVals, CastIdx, minIdx, outPos, chunk);
+                outIdxQueue.FreeTensor(minIdx);
+                return;
+            }
+        }
+        if (hasMask) {
+            PlaneApplySentinel(CastIdx, chunk);
+        }
+        uint32_t outLen = chunk;
+        if (c0 != 0) {
+            outLen = chunk / c0;
+            FoldC0(minVals, CastIdx, minIdx, outLen);
+        } else if constexpr (sizeof(IndexT) == 8) {
+            Cast(minIdx, CastIdx.ReinterpretCast<int32_t>(),AscendC::RoundMode::CAST_NONE,chunk);
+        }
+        outIdxQueue.EnQue(minIdx);
+        minIdx = outIdxQueue.DeQue<IndexT>();
+        DataCopyPad(outGm[outPos], minIdx, {1, static_cast<uint32_t>(outLen * sizeof(IndexT)), 0, 0, 0});
+        outIdxQueue.FreeTensor(minIdx);
+    }
+
+    template <HardEvent EVT>
+    __aicore__ inline void WaitEvent()
+    {
+        event_t e = static_cast<event_t>(pipe->FetchEventID(EVT));
+        SetFlag<EVT>(e);
+        WaitFlag<EVT>(e);
+    }
+
+    /*
+     * 流式：本块每列的 (最小值, 行号) 与输入状态合并后输出，本块严格更小时取本块，同值保留状态。
+     * 值按 Compare + Select 合并；int64 下标没有 64 位 Select，把选择位经 int32 的 -1/0 Cast 成
+     * 全 1/全 0 的 int64 掩码后按位合并
+     */
+    __aicore__ inline void MergePlaneState(LocalTensor<CmpT> &minVals, LocalTensor<float> &CastIdx,
+                                           LocalTensor<IndexT> &minIdx, uint32_t outPos, uint32_t len)
+    {
+        auto local = CastIdx.ReinterpretCast<int32_t>();
+        if constexpr (std::is_same<CmpT, half>::value || std::is_same<CmpT, float>::value ||
+                      std::is_same<CmpT, int32_t>::value) {
+            // 本块跨过 2^32 的整数倍时全局下标的高 32 位因行而异，按标量合并
+            if (sizeof(IndexT) == 4 ||
+                (static_cast<uint64_t>(chunkOffset) & 0xffffffffULL) + inner - 1 <= 0xffffffffULL) {
+                MergePlaneStateVector(minVals, local, minIdx, outPos, len);
+                return;
+            }
+        }
+        MergePlaneStateScalar(minVals, local, outPos, len);
+    }
+
+    __aicore__ inline void MergePlaneStateVector(LocalTensor<CmpT> &minVals, LocalTensor<int32_t> &local,
+                                                 LocalTensor<IndexT> &minIdx, uint32_t outPos, uint32_t len)
+    {
+        auto sv = bufStateVal.Get<ValueT>();
+        auto si = bufStateIdx.Get<IndexT>();
+        auto cmpMask = bufcmpMask.Get<uint8_t>();
+        // 上一个列块的状态写出完成后才能覆盖缓冲
+        WaitEvent<HardEvent::MTE3_MTE2>();
+        WaitEvent<HardEvent::MTE3_V>();
+        if (hasState) {
+            DataCopyPad(sv, stateValGm[outPos], {1, static_cast<uint32_t>(len * sizeof(ValueT)), 0, 0, 0},
+                        {false, 0, 0, 0});
+            DataCopyPad(si, stateIdxGm[outPos], {1, static_cast<uint32_t>(len * sizeof(IndexT)), 0, 0, 0},
+                        {false, 0, 0, 0});
+            WaitEvent<HardEvent::MTE2_V>();
+            Compare(cmpMask, minVals, sv, AscendC::CMPMODE::LT, CmpAlignedLen(len));
+            auto svSel = sv.template ReinterpretCast<SelT>();
+            Select(svSel, cmpMask, minVals.template ReinterpretCast<SelT>(), svSel,
+                   AscendC::SELMODE::VSEL_TENSOR_TENSOR_MODE, len);
+        } else {
+            DataCopy(sv, minVals, Align32Elems(len));
+        }
+        // 全局下标的低 32 位(按补码回绕)
+        Adds(local, local, static_cast<int32_t>(chunkOffset), len);
+        if constexpr (sizeof(IndexT) == 4) {
+            if (hasState) {
+                auto siSel = si.template ReinterpretCast<float>();
+                Select(siSel, cmpMask, local.ReinterpretCast<float>(), siSel,
+                       AscendC::SELMODE::VSEL_TENSOR_TENSOR_MODE, len);
+            } else {
+                DataCopy(si, local, Align8Elems(len));
+            }
+        } else {
+            // minVals 已用完，本块全局下标写进 minIdx：Cast 给出低 32 位，高 32 位在本块内不变，按奇数字写入
+            Cast(minIdx, local, AscendC::RoundMode::CAST_NONE, len);
+            uint64_t hiWords[2] = {0xaaaaaaaaaaaaaaaaULL, 0};
+            Duplicate(minIdx.template ReinterpretCast<int32_t>(), static_cast<int32_t>(chunkOffset >> 32), hiWords,
+                      static_cast<uint8_t>((len * 2 + 63) / 64), 1, 8);
+            // 取本块处为 -1，保留状态处为 0；首块全取本块
+            Duplicate(local, static_cast<int32_t>(-1), len);
+            if (hasState) {
+                auto flag = local.ReinterpretCast<float>();
+                Select(flag, cmpMask, flag, 0.0f, AscendC::SELMODE::VSEL_TENSOR_SCALAR_MODE, len);
+            }
+            auto wide = bufStateSel.Get<IndexT>();
+            Cast(wide, local, AscendC::RoundMode::CAST_NONE, len);
+            const uint32_t words = len * sizeof(IndexT) / sizeof(uint16_t);
+            auto w16 = wide.template ReinterpretCast<uint16_t>();
+            auto n16 = minIdx.template ReinterpretCast<uint16_t>();
+            auto s16 = si.template ReinterpretCast<uint16_t>();
+            And(n16, n16, w16, words);
+            Not(w16, w16, words);
+            And(s16, s16, w16, words);
+            Or(s16, s16, n16, words);
+        }
+        WaitEvent<HardEvent::V_MTE3>();
+        DataCopyPad(outValGm[outPos], sv, {1, static_cast<uint32_t>(len * sizeof(ValueT)), 0, 0, 0});
+        DataCopyPad(outGm[outPos], si, {1, static_cast<uint32_t>(len * sizeof(IndexT)), 0, 0, 0});
+    }
+
+    /* 标量逐列合并：没有向量比较的类型，以及本块跨过 2^32 整数倍的少见情形 */
+    __aicore__ inline void MergePlaneStateScalar(LocalTensor<CmpT> &minVals, LocalTensor<int32_t> &local,
+                                                 uint32_t outPos, uint32_t len)
+    {
+        auto sv = bufStateVal.Get<ValueT>();
+        auto si = bufStateIdx.Get<IndexT>();
+        WaitEvent<HardEvent::MTE3_MTE2>();
+        WaitEvent<HardEvent::MTE3_S>();
+        if (hasState) {
+            DataCopyPad(sv, stateValGm[outPos], {1, static_cast<uint32_t>(len * sizeof(ValueT)), 0, 0, 0},
+                        {false, 0, 0, 0});
+            DataCopyPad(si, stateIdxGm[outPos], {1, static_cast<uint32_t>(len * sizeof(IndexT)), 0, 0, 0},
+                        {false, 0, 0, 0});
+            WaitEvent<HardEvent::MTE2_S>();
+        }
+        WaitEvent<HardEvent::V_S>();
+        for (uint32_t c = 0; c < len; ++c) {
+            CmpT v = minVals.GetValue(c);
+            if (!hasState || Less(v, sv.GetValue(c))) {
+                sv.SetValue(c, v);
+                si.SetValue(c, chunkOffset + local.GetValue(c));
+            }
+        }
+        WaitEvent<HardEvent::S_MTE3>();
+        DataCopyPad(outValGm[outPos], sv, {1, static_cast<uint32_t>(len * sizeof(ValueT)), 0, 0, 0});
+        DataCopyPad(outGm[outPos], si, {1, static_cast<uint32_t>(len * sizeof(IndexT)), 0, 0, 0});
+    }
+
+    /*
+     * 5HD：每个 (h, w) 的 C0 个通道各自已有沿 C1 的最小值与 c1，标量折叠出通道下标 c = c1 * C0 + lane，
+     * 同值取 c 最小者。minIdx 可能与 minVals/CastIdx 共用 UB，但第 p 个输出只覆盖已读过的位置。
+     */
+    __aicore__ inline void FoldC0(LocalTensor<CmpT> &minVals, LocalTensor<float> &CastIdx,
+                                  LocalTensor<IndexT> &minIdx, uint32_t positions)
+    {
+        auto c1Idx = CastIdx.ReinterpretCast<int32_t>();
+        WaitEvent<HardEvent::V_S>();
+        for (uint32_t p = 0; p < positions; ++p) {
+            const uint32_t base = p * c0;
+            float best = static_cast<float>(minVals.GetValue(base));
+            int32_t bestC = c1Idx.GetValue(base) * static_cast<int32_t>(c0);
+            for (uint32_t lane = 1; lane < c0; ++lane) {
+                float v = static_cast<float>(minVals.GetValue(base + lane));
+                int32_t c = c1Idx.GetValue(base + lane) * static_cast<int32_t>(c0) + static_cast<int32_t>(lane);
+                if (v < best || (v == best && c < bestC)) {
+                    best = v;
+                    bestC = c;
+                }
+            }
+            minIdx.SetValue(p, static_cast<IndexT>(bestC));
+        }
+        WaitEvent<HardEvent::S_MTE3>();
+    }
+
+private:
+    static constexpr uint32_t TILE_INNER = std::is_same<ValueT, int64_t>::value ? 12288 : 24576;//310B上UB大小248K 如果在其他型号上跑可以适当调大/调小
+    static constexpr uint32_t SLICE_OUT_BATCH = 256;  // slice 路径一次写回的结果数
+    /*
+     * 平面路径列块大小(310B 上 UB 248K，其他型号可按比例调整)。
+     * int64 下标需要 int32 索引缓冲 + 8B 写回缓冲；int32 下标省掉 Cast 与一半写回缓冲，
+     * 省出的 UB 换成更大的列块：half 约 10B/列、float/bf16/int32 约 16B/列
+     */
+    static constexpr uint32_t TILE_COL =
+        std::is_same<ValueT, int64_t>::value ? (sizeof(IndexT) == 4 ? 8192 : 5120)
+        : sizeof(IndexT) == 8                ? 10240
+        : std::is_same<CmpT, half>::value    ? 20480
+                                             : 14336;
+
+    GlobalTensor<uint64_t>   xGm;
+    GlobalTensor<ValueT> xxGm;
+    GlobalTensor<IndexT> outGm;
+    // 流式变体的输入状态与输出最小值
+    GlobalTensor<ValueT> stateValGm;
+    GlobalTensor<IndexT> stateIdxGm;
+    GlobalTensor<ValueT> outValGm;
+    GlobalTensor<uint8_t> maskGm;
+
+    TPipe *pipe;
+
+    // Slice: 深度1；Plane: 深度2
+    TQue<TPosition::VECIN,  1> inSliceQueue;
+    TQue<TPosition::VECOUT, 1> outIdxQueue; // plane 用
+    TQue<TPosition::VECIN,  2> rowQueue;
+    TQue<TPosition::VECIN,  2> maskQueue;  // 与 inSliceQueue / rowQueue 同步入队
+    TBuf<TPosition::VECCALC> bufRow;
+    TBuf<TPosition::VECCALC> bufCastVals;
+    TBuf<TPosition::VECCALC> bufMinIdx;  // Slice ReduceMin 使用
+    TBuf<TPosition::VECCALC> bufSliceIdx;  // slice 路径本批结果
+    TBuf<TPosition::VECCALC> bufSliceVal;  // 流式 slice 路径本批最小值
+    TBuf<TPosition::VECCALC> bufcmpMask;
+    TBuf<TPosition::VECCALC> bufCastIdx;
+    TBuf<TPosition::VECCALC> bufStateVal;
+    TBuf<TPosition::VECCALC> bufStateIdx;
+    TBuf<TPosition::VECCALC> bufStateSel;
+    TBuf<TPosition::VECCALC> bufMaskHalf;
+    TBuf<TPosition::VECCALC> bufSelMask;
+    TBuf<TPosition::VECCALC> bufOnes;
+    TBuf<TPosition::VECCALC> bufAnyValid;
+    TBuf<TPosition::VECCALC> bufFirstValid;  // 本行有效且该列此前全被屏蔽的位图
+    LocalTensor<uint8_t> rowMask;            // 平面路径当前行的掩码，比较完成后释放
+
+    // AscendC::TQueSync<PIPE_V,   PIPE_MTE3> sync_V_to_MTE3;
+    // AscendC::TQueSync<PIPE_MTE2, PIPE_V>   sync_MTE2_to_V;
+    uint32_t inner_last;
+    uint32_t inner, outer, totalSize, stride_m, stride;
+    uint32_t blockIdx, blockNum;
+    uint32_t planes;
+    uint32_t colTile;
+    // NC1HWC0 沿 C 归约(tiling key 2)；c0 == 0 表示 ND
+    uint32_t c0 = 0;
+    bool hasPad = false;
+    uint64_t padMask[2] = {0, 0};
+    bool streaming = false;
+    bool hasState = false;
+    int64_t chunkOffset = 0;
+    bool hasMask = false;
+    bool maskPacked = false;
+    bool sliceAny = true;
+    int32_t maskedIndex = -1;
+    // 多轴归约的混合进制展开
+    static constexpr uint32_t MAX_GROUPS = 4;
+    uint32_t segLen;
+    uint32_t outerRank, redRank;
+    uint32_t outerDims[MAX_GROUPS], outerStrides[MAX_GROUPS];
+    uint32_t redDims[MAX_GROUPS], redStrides[MAX_GROUPS];
+};
+
+#endif // KERNEL_ARG_MIN_H
@@ -0,0 +1,17 @@
+#include "kernel_operator.h"
+#include "kernel_arg_min.h"
+
+/*
+ * 流式 ArgMin：在 ArgMin 的 slice/平面归约末尾把本块结果与 (min_val, min_idx) 合并，
+ * 每个分块只读一遍，y_val/y_idx 可与 min_val/min_idx 共用同一块 GM 就地更新。
+ */
+extern "C" __global__ __aicore__ void streaming_arg_min(GM_ADDR x, GM_ADDR min_val, GM_ADDR min_idx,
+                                                        GM_ADDR y_val, GM_ADDR y_idx,
+                                                        GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    KernelArgMin<DTYPE_X> op;
+    TPipe pipe;
+    op.InitStreaming(x, min_val, min_idx, y_val, y_idx, tilingData, &pipe);
+    op.Process();
+}
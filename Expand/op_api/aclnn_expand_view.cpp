@@ -0,0 +1,66 @@
+#include "aclnn_expand_view.h"
+#include <vector>
+#include "acl/acl_base.h"
+#include "opdev/op_log.h"
+#include "../op_host/expand_view.h"
+
+namespace {
+constexpr aclnnStatus EXPAND_VIEW_SUCCESS      = 0;
+constexpr aclnnStatus EXPAND_VIEW_PARAM_NULL   = 161001;
+constexpr aclnnStatus EXPAND_VIEW_PARAM_INVALID = 161002;
+} // namespace
+
+extern "C" aclnnStatus aclnnExpandView(const aclTensor *self, const int64_t *size, uint64_t sizeNum, aclTensor **out)
+{
+    if (self == nullptr || size == nullptr || out == nullptr) return EXPAND_VIEW_PARAM_NULL;
+
+    int64_t *viewDims = nullptr, *viewStrides = nullptr, *storageDims = nullptr;
+    uint64_t viewRank = 0, strideNum = 0, storageRank = 0;
+    int64_t offset = 0;
+    aclDataType dtype;
+    aclFormat format;
+    void *data = nullptr;
+    aclnnStatus ret = aclGetViewShape(self, &viewDims, &viewRank);
+    if (ret == EXPAND_VIEW_SUCCESS) ret = aclGetViewStrides(self, &viewStrides, &strideNum);
+    if (ret == EXPAND_VIEW_SUCCESS) ret = aclGetStorageShape(self, &storageDims, &storageRank);
+    if (ret == EXPAND_VIEW_SUCCESS) ret = aclGetViewOffset(self, &offset);
+    if (ret == EXPAND_VIEW_SUCCESS) ret = aclGetDataType(self, &dtype);
+    if (ret == EXPAND_VIEW_SUCCESS) ret = aclGetFormat(self, &format);
+    if (ret == EXPAND_VIEW_SUCCESS) ret = aclGetRawTensorAddr(self, &data);
+
+    std::vector<int64_t> outDims(sizeNum), outStrides(sizeNum);
+    if (ret == EXPAND_VIEW_SUCCESS &&
+        (strideNum != viewRank ||
+         !expand_view::ComputeExpandView(viewDims, viewStrides, viewRank, size, sizeNum,
+                                         outDims.data(), outStrides.data()))) {
+        ret = EXPAND_VIEW_PARAM_INVALID;
+    }
+    // 视图之后要能用 Expand(x_strides) 物化：不支持的 stride 形态在这里报出，而不是到 tiling 才失败
+    if (ret == EXPAND_VIEW_SUCCESS) {
+        const uint64_t lead = sizeNum - viewRank;
+        std::vector<int64_t> xDims(sizeNum, 1), xStrides(sizeNum, 0);
+        for (uint64_t i = 0; i < viewRank; ++i) {
+            xDims[lead + i] = viewDims[i];
+            xStrides[lead + i] = viewStrides[i];
+        }
+        expand_view::StridedRead read;
+        const expand_view::StridedReadStatus st = expand_view::ComputeStridedRead(
+            xDims.data(), static_cast<int>(sizeNum), size, xStrides.data(),
+            static_cast<uint32_t>(aclDataTypeSize(dtype)), read);
+        if (st != expand_view::STRIDED_READ_OK) {
+            OP_LOGE(EXPAND_VIEW_PARAM_INVALID, "aclnnExpandView: unsupported self strides, %s",
+                    expand_view::StridedReadMessage(st));
+            ret = EXPAND_VIEW_PARAM_INVALID;
+        }
+    }
+    if (ret == EXPAND_VIEW_SUCCESS) {
+        *out = aclCreateTensor(outDims.data(), sizeNum, dtype, outStrides.data(), offset, format,
+                               storageDims, storageRank, data);
+        if (*out == nullptr) ret = EXPAND_VIEW_PARAM_INVALID;
+    }
+    // aclGet*Shape / aclGetViewStrides 返回的数组由调用者释放
+    delete[] viewDims;
+    delete[] viewStrides;
+    delete[] storageDims;
+    return ret;
+}
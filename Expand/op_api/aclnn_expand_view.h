@@ -0,0 +1,29 @@
+#ifndef ACLNN_EXPAND_VIEW_H_
+#define ACLNN_EXPAND_VIEW_H_
+
+#include "aclnn/acl_meta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* aclnnExpandView
+ * 以 stride-0 视图的形式返回 self 按 size 广播后的结果，与 self 共享存储：
+ * 不下发 kernel，也不申请输出或 workspace。
+ * self: 可为非连续视图(stride 形态见下)；size: 目标 shape，维数不少于 self，前导多出的维按广播处理。
+ * out: 新建的视图 tensor，由调用者 aclDestroyTensor 释放。
+ * 下游算子要求连续输入时，再以 self 的 stride 作为 x_strides 调用 aclnnExpand 物化。
+ * 非连续的 self 只支持以下 stride 形态(否则返回 ACLNN_ERR_PARAM_INVALID 并打印原因)：
+ *   - 至少有一维 self 为 1 而 size 不为 1；
+ *   - 最低的这种广播维之下，末维 stride 为 1，其余维能合并成等距、不重叠的块；
+ *   - 上述一行的块数不超过 4095，且按 32B 对齐后不超过 120KB。
+ * 以 self 的 stride 调用 aclnnExpand 时限制相同，不满足时 tiling 失败。
+ */
+__attribute__((visibility("default")))
+aclnnStatus aclnnExpandView(const aclTensor *self, const int64_t *size, uint64_t sizeNum, aclTensor **out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
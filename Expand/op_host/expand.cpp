@@ -1,58 +1,131 @@
 
 #include "expand_tiling.h"
+#include "expand_layout.h"
+#include "expand_view.h"
 #include "register/op_def_registry.h"
 #include "tiling/platform/platform_ascendc.h"
+#include "../../common/launch_trace.h"
+#include "../../common/tiling_cache.h"
+#include <algorithm>
 
 
 namespace optiling {
-static ge::graphStatus TilingFunc(gert::TilingContext* context)
+// ASCEND_OPS_TRACE_DIR 打开时记录本次 launch，attrs 布局: [size 个数, size..., x_strides 个数, x_strides..., x 存储跨度]
+// 存储跨度(元素数)为最大偏移 + 1：非连续视图下 kernel 按 stride 读到的范围，而不是逻辑元素数
+static void CaptureTrace(gert::TilingContext* context, uint32_t dtypeSize)
+{
+  launch_trace::TraceRecord rec;
+  rec.op = launch_trace::TRACE_OP_EXPAND;
+  rec.dtype = static_cast<int32_t>(context->GetInputDesc(0)->GetDataType());
+  rec.format = static_cast<int32_t>(context->GetInputDesc(0)->GetStorageFormat());
+  const gert::Shape &ss = context->GetInputShape(0)->GetStorageShape();
+  uint64_t elems = 1;
+  for (size_t i = 0; i < ss.GetDimNum(); i++) {
+    rec.dims.push_back(ss.GetDim(i));
+    elems *= static_cast<uint64_t>(ss.GetDim(i));
+  }
+  auto *size = context->GetAttrs()->GetListInt(0);
+  rec.attrs.push_back(static_cast<int64_t>(size->GetSize()));
+  for (size_t i = 0; i < size->GetSize(); i++) rec.attrs.push_back(size->GetData()[i]);
+  auto *strides = context->GetAttrs()->GetListInt(1);
+  size_t stride_num = strides == nullptr ? 0 : strides->GetSize();
+  rec.attrs.push_back(static_cast<int64_t>(stride_num));
+  for (size_t i = 0; i < stride_num; i++) rec.attrs.push_back(strides->GetData()[i]);
+  uint64_t extent = elems;
+  if (stride_num == ss.GetDimNum() && elems != 0) {
+    extent = 1;
+    for (size_t i = 0; i < stride_num; i++) {
+      extent += static_cast<uint64_t>(ss.GetDim(i) - 1) * static_cast<uint64_t>(strides->GetData()[i]);
+    }
+  }
+  rec.attrs.push_back(static_cast<int64_t>(extent));
+  launch_trace::FillLaunch(rec, context);
+  // 输入数据只有在 host 侧可见时才能抓取，否则回放时按种子生成
+  const gert::Tensor *x = context->GetInputTensor(0);
+  if (launch_trace::TraceInputEnabled() && x != nullptr && x->GetAddr() != nullptr &&
+      (x->GetPlacement() == gert::kOnHost || x->GetPlacement() == gert::kFollowing)) {
+    const uint8_t *p = static_cast<const uint8_t *>(x->GetAddr());
+    rec.payload.assign(p, p + extent * dtypeSize);
+  }
+  launch_trace::WriteTrace(rec, "expand");
+}
+
+// x 以非连续视图(x_strides，单位为元素)传入时，第一级广播的每一行按 stride 直接读取，省掉前置的 contiguous 拷贝。
+// 支持的 stride 形态见 expand_view::ComputeStridedRead；返回 false 表示该视图无法用 DataCopyPad 直接读取。
+// x_dims / x_strides 已按 size 的维数在前面补齐；strided 返回是否走按 stride 读取的路径。
+static bool ComputeStridedRead(const int64_t *x_dims, int rank, const int64_t *y_dim, const int64_t *x_strides,
+                               uint32_t dtype_size, ExpandTilingData &tiling, bool &strided)
+{
+  expand_view::StridedRead r;
+  tiling.set_strided(0);
+  strided = false;
+  if (expand_view::ComputeStridedRead(x_dims, rank, y_dim, x_strides, dtype_size, r) != expand_view::STRIDED_READ_OK)
+    return false;
+  if (!r.strided) return true;
+
+  tiling.set_strided(1);
+  strided = true;
+  tiling.set_row_blocks(r.row_blocks);
+  tiling.set_block_len(r.block_len);
+  tiling.set_block_gap(r.block_gap);
+  tiling.set_outer_rank(r.outer_rank);
+  tiling.set_outer_dims(r.outer_dims);
+  tiling.set_outer_strides(r.outer_strides);
+  return true;
+}
+
+static uint32_t DataTypeSize(ge::DataType dtype)
+{
+  switch(dtype) {
+    case ge::DT_INT8:  return 1;
+    case ge::DT_INT16: return 2;
+    case ge::DT_INT32: return 4;
+    case ge::DT_INT64: return 8;
+    case ge::DT_UINT8:  return 1;
+    case ge::DT_UINT16: return 2;
+    case ge::DT_UINT32: return 4;
+    case ge::DT_UINT64: return 8;
+    case ge::DT_FLOAT16: return 2;
+    case ge::DT_FLOAT: return 4;
+    case ge::DT_BOOL: return 1;
+    case ge::DT_BF16: return 2;
+    default: return 4; // 默认 int32
+  }
+}
+
+static ge::graphStatus ComputeTiling(gert::TilingContext* context)
 {
 
   ExpandTilingData tiling;
   const gert::StorageShape* x1_shape = context->GetInputShape(0);
 
   int32_t data_sz = 1;
-  int dim = x1_shape->GetStorageShape().GetDimNum();
+  const int x_rank = x1_shape->GetStorageShape().GetDimNum();
+  const int dim = context->GetAttrs()->GetListInt(0)->GetSize();
   const long int* y_dim = context->GetAttrs()->GetListInt(0)->GetData();
+  // size 的维数可以多于 x(如 [C] -> [N,H,W,C])，按 numpy 规则在 x 前面补 1 对齐
+  if (dim < x_rank || dim > 8) return ge::GRAPH_FAILED;
+  const int lead = dim - x_rank;
+  int64_t x_dims[8];
+  for (int i = 0; i < dim; i++)
+    x_dims[i] = i < lead ? 1 : x1_shape->GetStorageShape().GetDim(i - lead);
+  int64_t y_dims[8];
+  for (int i = 0; i < dim; i++) y_dims[i] = y_dim[i];
+  // tiling 最多描述 3 级广播
+  expand_layout::ExpandLayout layout;
+  if (!expand_layout::ComputeExpandLayout(x_dims, y_dims, dim, layout)) return ge::GRAPH_FAILED;
   int32_t outer[3]={0};
   int32_t inner[3]={0};
   int32_t repeater[3]={0};
-  int64_t output_size = 1;
-  for (int i = 0; i < x1_shape->GetStorageShape().GetDimNum(); i++)
-    data_sz *= x1_shape->GetStorageShape().GetDim(i),
-    output_size *= y_dim[i];
-  tiling.set_size(data_sz);
-  context->SetBlockDim(1);
-  int out=data_sz;
-  int in=1;
-  int repeat=1;
-  int i=0;
-  int j=0;
-  while(dim-i-1>=0){
-    
-        
-    if(x1_shape->GetStorageShape().GetDim(dim-1-i)==1){
-        repeat*=y_dim[dim-1-i];
-    }else{
-        if(repeat!=1){
-            outer[j]=out;
-            inner[j]=in;
-            repeater[j]=repeat;
-            in*=repeater[j];
-            j++;
-        }
-        repeat=1;
-        out/=x1_shape->GetStorageShape().GetDim(dim-1-i);
-        in*=x1_shape->GetStorageShape().GetDim(dim-1-i);
-    }
-    ++i;
-  }
-  if(repeat!=1){
-      outer[j]=out;
-      inner[j]=in;
-      repeater[j]=repeat;
-      j++;
+  const int j = layout.levels;
+  for (int k = 0; k < j; k++) {
+    outer[k] = static_cast<int32_t>(layout.outer[k]);
+    inner[k] = static_cast<int32_t>(layout.inner[k]);
+    repeater[k] = static_cast<int32_t>(layout.repeater[k]);
   }
+  data_sz = static_cast<int32_t>(layout.in_elems);
+  const int64_t output_size = layout.out_elems;
+  tiling.set_size(data_sz);
   ge::DataType inputDataType = context->GetInputDesc(0)->GetDataType();
   tiling.set_Expandsize(j);
   tiling.set_outer(outer);
@@ -60,22 +133,7 @@ static ge::graphStatus TilingFunc(gert::TilingContext* context)
   tiling.set_repeater(repeater);
   tiling.set_outputsize(output_size);
   
-  uint32_t inputDataTypeSize = 0;
-  switch(inputDataType) {
-    case ge::DT_INT8:  inputDataTypeSize = 1;break;
-    case ge::DT_INT16: inputDataTypeSize = 2;break;
-    case ge::DT_INT32: inputDataTypeSize = 4;break;
-    case ge::DT_INT64: inputDataTypeSize = 8;break;
-    case ge::DT_UINT8:  inputDataTypeSize = 1;break;
-    case ge::DT_UINT16: inputDataTypeSize = 2;break;
-    case ge::DT_UINT32: inputDataTypeSize = 4;break;
-    case ge::DT_UINT64: inputDataTypeSize = 8;break;
-    case ge::DT_FLOAT16: inputDataTypeSize = 2;break;
-    case ge::DT_FLOAT: inputDataTypeSize = 4;break;
-    case ge::DT_BOOL: inputDataTypeSize = 1;break;
-    case ge::DT_BF16: inputDataTypeSize = 2;break;
-    default: inputDataTypeSize = 4;break; // 默认 int32
-  }
+  uint32_t inputDataTypeSize = DataTypeSize(inputDataType);
   // if(inputDataTypeSize == 1) {
   //   context->SetTilingKey(1);
   // }else if(inputDataTypeSize == 2) {
@@ -86,8 +144,27 @@ static ge::graphStatus TilingFunc(gert::TilingContext* context)
   //   context->SetTilingKey(4);
   // }
   tiling.set_datatypesize(inputDataTypeSize);
+  auto *x_strides = context->GetAttrs()->GetListInt(1);
+  bool strided = false;
+  if (x_strides != nullptr && x_strides->GetSize() > 0) {
+    if (x_strides->GetSize() != static_cast<size_t>(x_rank)) return ge::GRAPH_FAILED;
+    int64_t strides[8] = {0};
+    for (int k = 0; k < x_rank; k++) strides[lead + k] = x_strides->GetData()[k];
+    if (!ComputeStridedRead(x_dims, dim, y_dim, strides, inputDataTypeSize, tiling, strided))
+      return ge::GRAPH_FAILED;
+  }
   size_t usrSize = output_size * inputDataTypeSize+1024;
   auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+  // 只有一级广播时没有 workspace 乒乓，各核互不依赖，可以多核：
+  // outer 为 1(最外层/前导维整块复制)按 repeat 分核，否则按 outer 行分核；
+  // 非连续输入的第一级总是走 performStridedTileBroadcast，只按 outer 行分核
+  if (j == 1) {
+    int64_t units = (outer[0] == 1 && !strided) ? repeater[0] : outer[0];
+    int64_t cores = ascendcPlatform.GetCoreNumAiv();
+    context->SetBlockDim(static_cast<uint32_t>(std::max<int64_t>(1, std::min(cores, units))));
+  } else {
+    context->SetBlockDim(1);
+  }
   int32_t sysWorkspaceSize = ascendcPlatform.GetLibApiWorkSpaceSize();
   size_t *currentWorkspace = context->GetWorkspaceSizes(1); // 通过框架获取workspace的指针，GetWorkspaceSizes入参为所需workspace的块数。当前限制使用一块。
   if (j>1)//广播多次时才需要workspace
@@ -97,8 +174,38 @@ static ge::graphStatus TilingFunc(gert::TilingContext* context)
 
   return ge::GRAPH_SUCCESS;
 }
+
+static tiling_cache::TilingCache &Cache()
+{
+  static tiling_cache::TilingCache cache(tiling_cache::CapacityFromEnv());
+  return cache;
+}
+
+// tiling 只依赖 x 的 shape/dtype、size 与 x_strides 属性以及平台(核数、库 workspace 大小)
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+  auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+  tiling_cache::KeyBuilder key;
+  key.Add(static_cast<int64_t>(ascendcPlatform.GetSocVersion()))
+     .Add(ascendcPlatform.GetCoreNumAiv())
+     .Add(context->GetInputDesc(0)->GetDataType())
+     .AddShape(context->GetInputShape(0)->GetStorageShape())
+     .AddList(context->GetAttrs()->GetListInt(0))
+     .AddList(context->GetAttrs()->GetListInt(1));
+  if (!tiling_cache::Apply(Cache(), key.Str(), context)) {
+    if (ComputeTiling(context) != ge::GRAPH_SUCCESS) return ge::GRAPH_FAILED;
+    tiling_cache::Store(Cache(), key.Str(), context);
+  }
+  // trace 抓取在命中与未命中时都做
+  if (launch_trace::TraceDir() != nullptr) {
+    CaptureTrace(context, DataTypeSize(context->GetInputDesc(0)->GetDataType()));
+  }
+  return ge::GRAPH_SUCCESS;
+}
 }
 
+TILING_CACHE_EXPORT_STATS(expand, optiling::Cache())
+
 
 namespace ge {
 static ge::graphStatus InferShape(gert::InferShapeContext* context)
@@ -148,6 +255,7 @@ public:
         //     .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
         
         this->Attr("size").ListInt();
+        this->Attr("x_strides").AttrType(OPTIONAL).ListInt({});
 
         this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
 
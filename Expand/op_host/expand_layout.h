@@ -0,0 +1,115 @@
+#ifndef EXPAND_LAYOUT_H
+#define EXPAND_LAYOUT_H
+/*
+ * Expand 的广播分解：从最低维往上，每遇到一段连续的广播维(x 为 1)记一级 (outer, repeater, inner)，
+ * 第 j 级把 [outer, inner] 扩成 [outer, repeater, inner]，inner 含已展开的低级广播。最多 3 级。
+ * 反向(ReduceSumToShape)用同一分解在广播轴上求和：广播组即被求和的组，其余为保留组，
+ * 一次遍历直接得到 dx，按末组是保留组/广播组分为平面路径与 slice 路径(与 ArgMin 的轴分解同构)。
+ * 不依赖 CANN 头文件，Expand、ReduceSumToShape 的 tiling 与离线分析工具共用。
+ */
+#include <cstdint>
+
+namespace expand_layout {
+constexpr int32_t MAX_RANK = 8;
+constexpr int32_t MAX_LEVELS = 3;
+constexpr int32_t MAX_GROUPS = 4;  // 3 级广播之间最多 4 个保留组
+
+struct ExpandLayout {
+    int32_t levels = 0;
+    int64_t outer[MAX_LEVELS] = {0};
+    int64_t repeater[MAX_LEVELS] = {0};
+    int64_t inner[MAX_LEVELS] = {0};
+    int64_t in_elems = 1;   // x 元素数
+    int64_t out_elems = 1;  // y 元素数
+};
+
+/* x_dims 已按 y 的维数在前面补 1；广播超过 MAX_LEVELS 级时返回 false */
+inline bool ComputeExpandLayout(const int64_t *x_dims, const int64_t *y_dims, int32_t rank, ExpandLayout &l)
+{
+    l = ExpandLayout();
+    for (int32_t i = 0; i < rank; ++i) {
+        l.in_elems *= x_dims[i];
+        l.out_elems *= y_dims[i];
+    }
+    int64_t out = l.in_elems;
+    int64_t in = 1;
+    int64_t repeat = 1;
+    int32_t j = 0;
+    for (int32_t i = rank - 1; i >= 0; --i) {
+        if (x_dims[i] == 1) {
+            repeat *= y_dims[i];
+            continue;
+        }
+        if (repeat != 1) {
+            if (j >= MAX_LEVELS) return false;
+            l.outer[j] = out;
+            l.inner[j] = in;
+            l.repeater[j] = repeat;
+            in *= repeat;
+            j++;
+        }
+        repeat = 1;
+        out /= x_dims[i];
+        in *= x_dims[i];
+    }
+    if (repeat != 1) {
+        if (j >= MAX_LEVELS) return false;
+        l.outer[j] = out;
+        l.inner[j] = in;
+        l.repeater[j] = repeat;
+        j++;
+    }
+    l.levels = j;
+    return true;
+}
+
+struct SumToShapeLayout {
+    uint64_t outputs = 1;   // dx 元素数
+    uint64_t rows = 1;      // 每个输出累加的元素数，即各级 repeater 之积
+    uint64_t cols = 0;      // 末组为保留组时为其长度(平面路径)，0 表示末组是广播组(slice 路径)
+    uint64_t seg_len = 1;   // slice 路径每段连续元素数，即最内层 repeater
+    uint32_t outer_rank = 0;                  // 平面/slice 起点的保留组(不含作为列的末组)
+    uint64_t outer_dims[MAX_GROUPS] = {0};
+    uint64_t outer_strides[MAX_GROUPS] = {0};
+    uint32_t red_rank = 0;                    // 行/段起点的广播组(slice 路径不含最内层)
+    uint64_t red_dims[MAX_GROUPS] = {0};
+    uint64_t red_strides[MAX_GROUPS] = {0};
+};
+
+/* 把逐级分解还原成 dy 上高维在前、交替出现的保留组与广播组，长度为 1 的保留组省略 */
+inline void ComputeSumToShapeLayout(const ExpandLayout &e, SumToShapeLayout &s)
+{
+    s = SumToShapeLayout();
+    s.outputs = static_cast<uint64_t>(e.in_elems);
+    if (e.levels == 0) {
+        s.cols = s.outputs;
+        return;
+    }
+    const int32_t top = e.levels - 1;
+    auto add_kept = [&s](int64_t size, int64_t stride) {
+        if (size > 1) {
+            s.outer_dims[s.outer_rank] = static_cast<uint64_t>(size);
+            s.outer_strides[s.outer_rank++] = static_cast<uint64_t>(stride);
+        }
+    };
+    add_kept(e.outer[top], e.repeater[top] * e.inner[top]);
+    for (int32_t j = top; j >= 0; --j) {
+        s.rows *= static_cast<uint64_t>(e.repeater[j]);
+        if (j == 0 && e.inner[0] == 1) {
+            // 最内层广播组就是末组：每段 repeater[0] 个连续元素
+            s.seg_len = static_cast<uint64_t>(e.repeater[0]);
+            break;
+        }
+        s.red_dims[s.red_rank] = static_cast<uint64_t>(e.repeater[j]);
+        s.red_strides[s.red_rank++] = static_cast<uint64_t>(e.inner[j]);
+        if (j > 0) {
+            const int64_t below = e.repeater[j - 1] * e.inner[j - 1];
+            add_kept(e.inner[j] / below, below);
+        } else {
+            s.cols = static_cast<uint64_t>(e.inner[0]);
+        }
+    }
+}
+} // namespace expand_layout
+
+#endif // EXPAND_LAYOUT_H
@@ -10,7 +10,15 @@ BEGIN_TILING_DATA_DEF(ExpandTilingData)
   TILING_DATA_FIELD_DEF(int32_t,outputsize);
   TILING_DATA_FIELD_DEF(int32_t,Expandsize);
   TILING_DATA_FIELD_DEF(int32_t,datatypesize);
-  
+  // x 为非连续视图时，第一级广播按 stride 直接从 x 读取(见 ComputeStridedRead)
+  TILING_DATA_FIELD_DEF(int32_t,strided);
+  TILING_DATA_FIELD_DEF(int32_t,row_blocks);   // 第一级每行拆成的连续块数，即 DataCopyPad 的 blockCount
+  TILING_DATA_FIELD_DEF(int32_t,block_len);    // 每块元素数
+  TILING_DATA_FIELD_DEF(int32_t,block_gap);    // 相邻块之间跳过的元素数，即 srcStride
+  TILING_DATA_FIELD_DEF(int32_t,outer_rank);   // 第一级 outer 下标按下面的维度展开求行首偏移
+  TILING_DATA_FIELD_DEF_ARR(int32_t, 8, outer_dims);
+  TILING_DATA_FIELD_DEF_ARR(int32_t, 8, outer_strides);
+
 END_TILING_DATA_DEF;
 
 REGISTER_TILING_DATA_CLASS(Expand, ExpandTilingData)
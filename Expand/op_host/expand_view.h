@@ -0,0 +1,138 @@
+#ifndef EXPAND_VIEW_H
+#define EXPAND_VIEW_H
+/*
+ * Expand 的零拷贝视图：广播轴(x 为 1 或 size 多出的前导维)的 stride 取 0，其余轴沿用 x 的 stride。
+ * 得到的视图与 x 共享存储，不发 kernel、不申请输出/workspace。
+ * 下游需要连续张量时再用 Expand(x_strides = x 的 stride) 一次物化，x 的 stride 形态须满足 ComputeStridedRead。
+ * 不依赖 CANN 头文件，aclnn 接口与离线工具共用。
+ */
+#include <cstddef>
+#include <cstdint>
+
+namespace expand_view {
+// 成功返回 true，out_dims / out_strides 需至少 size_rank 个元素
+inline bool ComputeExpandView(const int64_t *x_dims, const int64_t *x_strides, size_t x_rank,
+                              const int64_t *size, size_t size_rank,
+                              int64_t *out_dims, int64_t *out_strides)
+{
+    if (size_rank < x_rank) return false;
+    const size_t lead = size_rank - x_rank;
+    for (size_t i = 0; i < size_rank; ++i) {
+        out_dims[i] = size[i];
+        if (i < lead) {
+            if (size[i] < 0) return false;
+            out_strides[i] = 0;
+            continue;
+        }
+        const size_t k = i - lead;
+        if (x_dims[k] == size[i]) {
+            out_strides[i] = x_strides[k];
+        } else if (x_dims[k] == 1 && size[i] >= 0) {
+            out_strides[i] = 0;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Expand 以 x_strides 物化非连续视图时，第一级广播的每一行按 stride 直接读取。支持的 stride 形态：
+ * 至少有一个广播维；最低广播维之下末维 stride 为 1、其余维可合并成等距且不重叠的块；
+ * 多块的行一次放得进一个 UB 缓冲。不满足时 Expand 的 tiling 失败。
+ */
+enum StridedReadStatus {
+    STRIDED_READ_OK = 0,
+    STRIDED_READ_NO_BROADCAST,    // 非连续视图没有广播维
+    STRIDED_READ_INNER_STRIDE,    // 最低广播维之下末维 stride 不为 1
+    STRIDED_READ_NOT_MERGEABLE,   // 最低广播维之下其余维不能合并成等距、不重叠的块
+    STRIDED_READ_TOO_MANY_BLOCKS, // 一行的块数超过 DataCopyPad 上限或放不进一个 UB 缓冲
+};
+
+constexpr int MAX_STRIDED_RANK = 8;
+constexpr int64_t MAX_ROW_BLOCKS = 4095;                // DataCopyPad 的 blockCount 上限
+constexpr int64_t MAX_ROW_BYTES = 240 * 1024 / 2;       // 与 kernel 中 UB_BYTES / BUFFER_NUM 一致
+
+struct StridedRead {
+    bool strided = false;  // false 表示 x 实为连续，按普通路径读取
+    int32_t row_blocks = 1, block_len = 1, block_gap = 0;
+    int32_t outer_rank = 0;
+    int32_t outer_dims[MAX_STRIDED_RANK] = {0};
+    int32_t outer_strides[MAX_STRIDED_RANK] = {0};
+};
+
+/*
+ * x_dims / x_strides 已按 y_dims 的维数在前面补齐，stride 以元素为单位。
+ * 一行 = row_blocks 个长 block_len、间隔 block_gap 的块；行首偏移由最低广播维之上的非 1 维按 stride 展开
+ */
+inline StridedReadStatus ComputeStridedRead(const int64_t *x_dims, int rank, const int64_t *y_dims,
+                                            const int64_t *x_strides, uint32_t dtype_size, StridedRead &r)
+{
+    r = StridedRead();
+    bool dense = true;
+    int64_t expect = 1;
+    for (int i = rank - 1; i >= 0; --i) {
+        if (x_dims[i] == 1) continue;
+        if (x_strides[i] != expect) dense = false;
+        expect *= x_dims[i];
+    }
+    if (dense) return STRIDED_READ_OK;
+
+    int b = -1;  // 最低的广播维
+    for (int i = rank - 1; i >= 0; --i) {
+        if (x_dims[i] == 1 && y_dims[i] != 1) { b = i; break; }
+    }
+    if (b < 0) return STRIDED_READ_NO_BROADCAST;
+
+    int32_t in_dims[MAX_STRIDED_RANK], in_strides[MAX_STRIDED_RANK], in_rank = 0;
+    for (int i = 0; i < rank; ++i) {
+        if (x_dims[i] == 1) continue;
+        if (i < b) {
+            if (r.outer_rank >= MAX_STRIDED_RANK) return STRIDED_READ_NOT_MERGEABLE;
+            r.outer_dims[r.outer_rank] = static_cast<int32_t>(x_dims[i]);
+            r.outer_strides[r.outer_rank++] = static_cast<int32_t>(x_strides[i]);
+        } else {
+            if (in_rank >= MAX_STRIDED_RANK) return STRIDED_READ_NOT_MERGEABLE;
+            in_dims[in_rank] = static_cast<int32_t>(x_dims[i]);
+            in_strides[in_rank++] = static_cast<int32_t>(x_strides[i]);
+        }
+    }
+    if (in_rank > 0) {
+        if (in_strides[in_rank - 1] != 1) return STRIDED_READ_INNER_STRIDE;
+        r.block_len = in_dims[in_rank - 1];
+        for (int k = 0; k + 1 < in_rank; ++k) {
+            r.row_blocks *= in_dims[k];
+            if (k + 2 < in_rank && in_strides[k] != in_strides[k + 1] * in_dims[k + 1]) {
+                return STRIDED_READ_NOT_MERGEABLE;
+            }
+        }
+        if (in_rank > 1) r.block_gap = in_strides[in_rank - 2] - r.block_len;
+        if (r.block_gap < 0) return STRIDED_READ_NOT_MERGEABLE;
+    }
+    // 多块的行需要一次放进一个 UB 缓冲
+    const int64_t block_bytes = (static_cast<int64_t>(r.block_len) * dtype_size + 31) / 32 * 32;
+    if (r.row_blocks > 1 && (r.row_blocks > MAX_ROW_BLOCKS || r.row_blocks * block_bytes > MAX_ROW_BYTES)) {
+        return STRIDED_READ_TOO_MANY_BLOCKS;
+    }
+    r.strided = true;
+    return STRIDED_READ_OK;
+}
+
+inline const char *StridedReadMessage(StridedReadStatus s)
+{
+    switch (s) {
+        case STRIDED_READ_NO_BROADCAST:
+            return "non-contiguous input without a broadcast dim is not supported, make it contiguous first";
+        case STRIDED_READ_INNER_STRIDE:
+            return "stride of the innermost non-broadcast dim must be 1";
+        case STRIDED_READ_NOT_MERGEABLE:
+            return "dims below the lowest broadcast dim must merge into evenly spaced, non-overlapping blocks";
+        case STRIDED_READ_TOO_MANY_BLOCKS:
+            return "a row below the lowest broadcast dim has too many blocks to fit in one UB buffer";
+        default:
+            return "ok";
+    }
+}
+} // namespace expand_view
+
+#endif // EXPAND_VIEW_H
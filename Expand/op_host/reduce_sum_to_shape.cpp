@@ -0,0 +1,184 @@
+#include "reduce_sum_to_shape_tiling.h"
+#include "expand_layout.h"
+#include "register/op_def_registry.h"
+#include "tiling/platform/platform_ascendc.h"
+#include <algorithm>
+
+namespace optiling {
+constexpr uint64_t UB_RESERVED_BYTES = 8192; // ReduceSum 工作区、各 buffer 的 32B 尾部填充
+constexpr uint64_t ELEM_ALIGN = 128;
+constexpr uint64_t MAX_TILE_ELEMS = 16384;
+constexpr uint64_t COL_ALIGN = 16;           // 平面路径子行在 UB 中按 16 个元素对齐(half/bf16 32B，float 64B)
+constexpr uint64_t MIN_COL_TILE = 64;        // 为了分核切列时每个工作项至少 64 列，避免 DMA 过碎
+constexpr uint64_t MAX_BLOCK_COUNT = 4095;   // DataCopyPad 的 blockCount 上限
+constexpr uint64_t MAX_REPEAT = 255;
+constexpr uint64_t SHORT_SEG_MAX = 64;       // WholeReduceSum 一个 repeat 最多 64 个 fp32
+constexpr uint64_t MIN_PART_ELEMS = 4096;    // 切行分核时每段至少累加的元素数，太少时合并的开销盖过分核收益
+
+/*
+ * 每个元素占用的 UB 字节数，必须与 KernelReduceSumToShape::Init 一致：
+ *   输入双缓冲 2*es、写回 es、fp32 累加 4，fp16/bf16 另需 fp32 cast 缓冲 4
+ */
+static uint64_t BytesPerElem(ge::DataType dtype)
+{
+    const uint64_t es = dtype == ge::DT_FLOAT ? 4 : 2;
+    return 3 * es + 4 + (dtype == ge::DT_FLOAT ? 0 : 4);
+}
+
+static uint64_t RoundUp(uint64_t n, uint64_t a) { return (n + a - 1) / a * a; }
+
+static ge::graphStatus TilingFunc(gert::TilingContext* context)
+{
+    ReduceSumToShapeTilingData tiling;
+    const auto &ss = context->GetInputShape(0)->GetStorageShape();
+    const auto *shape = context->GetAttrs()->GetListInt(0);
+    const int rank = ss.GetDimNum();
+    const int x_rank = shape->GetSize();
+    if (x_rank > rank || rank > expand_layout::MAX_RANK) return ge::GRAPH_FAILED;
+
+    // dx 的 shape 按 numpy 规则在前面补 1，每维要么与 dy 相同要么为 1
+    const int lead = rank - x_rank;
+    int64_t x_dims[expand_layout::MAX_RANK];
+    int64_t y_dims[expand_layout::MAX_RANK];
+    for (int i = 0; i < rank; ++i) {
+        y_dims[i] = ss.GetDim(i);
+        x_dims[i] = i < lead ? 1 : shape->GetData()[i - lead];
+        if (x_dims[i] != 1 && x_dims[i] != y_dims[i]) return ge::GRAPH_FAILED;
+    }
+    expand_layout::ExpandLayout e;
+    expand_layout::SumToShapeLayout l;
+    if (!expand_layout::ComputeExpandLayout(x_dims, y_dims, rank, e)) return ge::GRAPH_FAILED;
+    if (e.out_elems <= 0) return ge::GRAPH_FAILED;
+    expand_layout::ComputeSumToShapeLayout(e, l);
+
+    const ge::DataType dtype = context->GetInputDesc(0)->GetDataType();
+    const uint64_t es = dtype == ge::DT_FLOAT ? 4 : 2;
+    auto ascendcPlatform = platform_ascendc::PlatformAscendC(context->GetPlatformInfo());
+    uint64_t ub_size = 0;
+    ascendcPlatform.GetCoreMemSize(platform_ascendc::CoreMemType::UB, ub_size);
+    const uint64_t budget = ub_size > UB_RESERVED_BYTES ? ub_size - UB_RESERVED_BYTES : 0;
+    const uint64_t tile_elems = std::min(MAX_TILE_ELEMS, budget / BytesPerElem(dtype) / ELEM_ALIGN * ELEM_ALIGN);
+    if (tile_elems == 0) return ge::GRAPH_FAILED;
+    const uint64_t cores = std::max<uint32_t>(1, ascendcPlatform.GetCoreNumAiv());
+
+    uint64_t units = 0;
+    uint64_t col_tile = 0, row_batch = 0, short_batch = 0;
+    if (l.cols != 0) {
+        // 平面数不够分核时把列切细，每个 (平面, 列块) 是一个工作项
+        const uint64_t planes = l.outputs / l.cols;
+        const uint64_t splits = std::max<uint64_t>(1, (cores + planes - 1) / planes);
+        col_tile = RoundUp((l.cols + splits - 1) / splits, COL_ALIGN);
+        col_tile = std::min(tile_elems, std::max(std::min(MIN_COL_TILE, RoundUp(l.cols, COL_ALIGN)), col_tile));
+        units = planes * ((l.cols + col_tile - 1) / col_tile);
+        // 最内层广播组内的行等距，一次 DataCopyPad 搬入 row_batch 行
+        const uint64_t inner_rows = l.red_rank == 0 ? 1 : l.red_dims[l.red_rank - 1];
+        row_batch = std::max<uint64_t>(1, std::min({tile_elems / col_tile, inner_rows, MAX_BLOCK_COUNT}));
+    } else {
+        units = l.outputs;
+        // 只有一段且段短时各输出的段首尾相接，一次搬入多个输出，每个 repeat 归约一个
+        if (l.red_rank == 0 && l.seg_len <= SHORT_SEG_MAX) {
+            const uint64_t seg_pad = RoundUp(l.seg_len * es, 32) / es;
+            short_batch = std::min(MAX_REPEAT, (tile_elems - SHORT_SEG_MAX) / seg_pad);
+        }
+    }
+
+    // 工作项够分核时每个输出只由一个核计算；不够时(如 [N]->[1]、偏置梯度 [B*S,64]->[64])
+    // 再把每个工作项的累加行切成 row_parts 段，各段的 fp32 部分和写到 workspace，同步后按段号顺序合并
+    uint64_t row_parts = 1, part_rows = l.rows;
+    if (units < cores) {
+        const uint64_t unit_elems = l.cols != 0 ? l.rows * std::min(col_tile, l.cols) : l.rows;
+        row_parts = std::min({(cores + units - 1) / units, std::max<uint64_t>(1, unit_elems / MIN_PART_ELEMS),
+                              l.rows});
+        part_rows = (l.rows + row_parts - 1) / row_parts;
+        row_parts = (l.rows + part_rows - 1) / part_rows;
+    }
+
+    uint32_t outer_dims[expand_layout::MAX_GROUPS] = {0};
+    uint32_t outer_strides[expand_layout::MAX_GROUPS] = {0};
+    uint32_t red_dims[expand_layout::MAX_GROUPS] = {0};
+    uint32_t red_strides[expand_layout::MAX_GROUPS] = {0};
+    for (uint32_t i = 0; i < l.outer_rank; ++i) {
+        outer_dims[i] = static_cast<uint32_t>(l.outer_dims[i]);
+        outer_strides[i] = static_cast<uint32_t>(l.outer_strides[i]);
+    }
+    for (uint32_t i = 0; i < l.red_rank; ++i) {
+        red_dims[i] = static_cast<uint32_t>(l.red_dims[i]);
+        red_strides[i] = static_cast<uint32_t>(l.red_strides[i]);
+    }
+    tiling.set_total(static_cast<uint32_t>(e.out_elems));
+    tiling.set_outputs(static_cast<uint32_t>(l.outputs));
+    tiling.set_rows(static_cast<uint32_t>(l.rows));
+    tiling.set_cols(static_cast<uint32_t>(l.cols));
+    tiling.set_seg_len(static_cast<uint32_t>(l.seg_len));
+    tiling.set_outer_rank(l.outer_rank);
+    tiling.set_outer_dims(outer_dims);
+    tiling.set_outer_strides(outer_strides);
+    tiling.set_red_rank(l.red_rank);
+    tiling.set_red_dims(red_dims);
+    tiling.set_red_strides(red_strides);
+    tiling.set_tile_elems(static_cast<uint32_t>(tile_elems));
+    tiling.set_col_tile(static_cast<uint32_t>(col_tile));
+    tiling.set_row_batch(static_cast<uint32_t>(row_batch));
+    tiling.set_short_batch(static_cast<uint32_t>(short_batch));
+    tiling.set_row_parts(static_cast<uint32_t>(row_parts));
+    tiling.set_part_rows(static_cast<uint32_t>(part_rows));
+    context->SetTilingKey(l.cols != 0 ? 0 : 1);
+    context->SetBlockDim(static_cast<uint32_t>(std::max<uint64_t>(1, std::min(cores, units * row_parts))));
+    size_t *currentWorkspace = context->GetWorkspaceSizes(1);
+    // 切行时每段一份 outputs 个 fp32 的部分和
+    const uint64_t usrSize = row_parts > 1 ? row_parts * l.outputs * sizeof(float) : 0;
+    currentWorkspace[0] = usrSize + ascendcPlatform.GetLibApiWorkSpaceSize();
+    tiling.SaveToBuffer(context->GetRawTilingData()->GetData(), context->GetRawTilingData()->GetCapacity());
+    context->GetRawTilingData()->SetDataSize(tiling.GetDataSize());
+    return ge::GRAPH_SUCCESS;
+}
+} // namespace optiling
+
+namespace ge {
+static ge::graphStatus InferShape(gert::InferShapeContext* context)
+{
+    const auto *shape = context->GetAttrs()->GetListInt(0);
+    gert::Shape* y_shape = context->GetOutputShape(0);
+    y_shape->SetDimNum(shape->GetSize());
+    for (size_t i = 0; i < shape->GetSize(); i++) {
+        y_shape->SetDim(i, shape->GetData()[i]);
+    }
+    return GRAPH_SUCCESS;
+}
+
+static ge::graphStatus InferDataType(gert::InferDataTypeContext *context)
+{
+    context->SetOutputDataType(0, context->GetInputDataType(0));
+    return GRAPH_SUCCESS;
+}
+} // namespace ge
+
+
+namespace ops {
+/* Expand 的反向：dy 在 Expand 广播出的轴上求和，得到 shape 属性给出的 dx */
+class ReduceSumToShape : public OpDef {
+public:
+    explicit ReduceSumToShape(const char* name) : OpDef(name)
+    {
+        this->Input("x")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_BF16, ge::DT_FLOAT, ge::DT_FLOAT16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Output("y")
+            .ParamType(REQUIRED)
+            .DataType({ge::DT_BF16, ge::DT_FLOAT, ge::DT_FLOAT16})
+            .Format({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND})
+            .UnknownShapeFormat({ge::FORMAT_ND, ge::FORMAT_ND, ge::FORMAT_ND});
+        this->Attr("shape").ListInt();
+
+        this->SetInferShape(ge::InferShape).SetInferDataType(ge::InferDataType);
+
+        this->AICore()
+            .SetTiling(optiling::TilingFunc);
+        this->AICore().AddConfig("ascend310b");
+    }
+};
+
+OP_ADD(ReduceSumToShape);
+}
@@ -0,0 +1,26 @@
+#include "register/tilingdata_base.h"
+
+namespace optiling {
+BEGIN_TILING_DATA_DEF(ReduceSumToShapeTilingData)
+  TILING_DATA_FIELD_DEF(uint32_t, total);      // dy 元素数
+  TILING_DATA_FIELD_DEF(uint32_t, outputs);    // dx 元素数
+  TILING_DATA_FIELD_DEF(uint32_t, rows);       // 每个输出累加的元素数
+  TILING_DATA_FIELD_DEF(uint32_t, cols);       // 平面路径每行连续元素数(tiling key 0)
+  TILING_DATA_FIELD_DEF(uint32_t, seg_len);    // slice 路径每段连续元素数(tiling key 1)
+  // 轴分解，见 expand_layout.h 的 SumToShapeLayout
+  TILING_DATA_FIELD_DEF(uint32_t, outer_rank);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, outer_dims);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, outer_strides);
+  TILING_DATA_FIELD_DEF(uint32_t, red_rank);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, red_dims);
+  TILING_DATA_FIELD_DEF_ARR(uint32_t, 4, red_strides);
+  TILING_DATA_FIELD_DEF(uint32_t, tile_elems); // UB 中 fp32 累加缓冲的元素数
+  TILING_DATA_FIELD_DEF(uint32_t, col_tile);   // 平面路径每个工作项的列数
+  TILING_DATA_FIELD_DEF(uint32_t, row_batch);  // 平面路径一次搬入的最内层广播行数
+  TILING_DATA_FIELD_DEF(uint32_t, short_batch);// slice 路径一次处理的短段数，0 表示逐个输出处理
+  TILING_DATA_FIELD_DEF(uint32_t, row_parts);  // 每个工作项的累加元素切成几段分核，1 表示不切
+  TILING_DATA_FIELD_DEF(uint32_t, part_rows);  // 每段的行数(平面路径)或元素数(slice 路径)
+END_TILING_DATA_DEF;
+
+REGISTER_TILING_DATA_CLASS(ReduceSumToShape, ReduceSumToShapeTilingData)
+}
@@ -67,6 +67,16 @@ public:
             this->inner[i] = tiling.inner[i];
             // printf("outer:%d repeat:%d inner:%d\n",this->outer[i],this->repeater[i],this->inner[i]);
         }
+        this->strided = tiling.strided;
+        this->row_blocks = tiling.row_blocks;
+        this->block_len = tiling.block_len;
+        this->block_gap = tiling.block_gap;
+        this->outer_rank = tiling.outer_rank;
+        for (int i = 0; i < 8; ++i)
+        {
+            this->outer_dims[i] = tiling.outer_dims[i];
+            this->outer_strides[i] = tiling.outer_strides[i];
+        }
         this->tiling_size = tiling.size;
         this->outputsize = tiling.outputsize;
         this->total_outer_repeats = tiling.Expandsize;
@@ -104,6 +114,17 @@ public:
                 srcGm.SetGlobalBuffer(reinterpret_cast<__gm__ T *>(src_addr));
                 src32Gm.SetGlobalBuffer(reinterpret_cast<__gm__ int32_t *>(src_addr));
             }
+            if (idx == 0 && this->strided)
+            {
+                for (int32_t outer_idx = this->blockIdx; outer_idx < this->outer[0]; outer_idx += this->blockStride)
+                    performStridedTileBroadcast(outer_idx);
+                continue;
+            }
+            if (this->outer[idx] == 1)
+            {
+                performBlockReplicate(idx);
+                continue;
+            }
             int32_t step = 1;
             if(inner[idx]*sizeof(T)>=32)//inner中等大小
                 step = max(1,min(outer[idx],ub_buf_elems / inner[idx]));
@@ -122,6 +143,17 @@ public:
     {
         return outer_index * (int32_t)(this->inner[tile_idx] * this->repeater[tile_idx]);
     }
+    // 非连续输入：第一级第 outer_index 行在 x 中的行首偏移
+    __aicore__ inline int32_t compute_strided_in_base(int32_t outer_index)
+    {
+        int32_t off = 0;
+        for (int32_t d = this->outer_rank - 1; d >= 0; --d)
+        {
+            off += (outer_index % this->outer_dims[d]) * this->outer_strides[d];
+            outer_index /= this->outer_dims[d];
+        }
+        return off;
+    }
 
     __aicore__ inline bool is32AlignedElem(int32_t offset_elems) const
     {
@@ -232,8 +264,6 @@ public:
         int32_t in_base = compute_in_base(tile_idx, outer_index);
         int32_t out_base = compute_out_base(tile_idx, outer_index);
 
-        int32_t chunk_elems = min(this->ub_buf_elems, inner_elems);
-        int32_t num_chunks = (inner_elems + chunk_elems - 1) / chunk_elems;
         if(step>1){
             DataCopyExtParams cp_in{static_cast<uint16_t>(step),static_cast<uint32_t>(inner_elems*sizeof(T)),0,0,0};
             DataCopyExtParams cp_out{static_cast<uint16_t>(step),static_cast<uint32_t>(inner_elems*sizeof(T)),0,static_cast<uint32_t>((repeat-1)*inner_elems*sizeof(T)),0};
@@ -248,6 +278,13 @@ public:
                     DataCopyPad(dstGm[out_base+i*inner_elems],buf,cp_out);
             Queue.FreeTensor<T>(buf);
         }else
+            performRowBroadcast(in_base, out_base, inner_elems, repeat);
+    }
+    __aicore__ inline void performRowBroadcast(int32_t in_base, int32_t out_base,
+                                               int32_t inner_elems, int32_t repeat)
+    {
+        int32_t chunk_elems = min(this->ub_buf_elems, inner_elems);
+        int32_t num_chunks = (inner_elems + chunk_elems - 1) / chunk_elems;
         for (int32_t c = 0; c < num_chunks; ++c)
         {
             int32_t offset = c * chunk_elems;
@@ -257,6 +294,63 @@ public:
             copyOut(out_base, offset, inner_elems, fill_elems, repeat, cur);
         }
     }
+    // outer 为 1 的一级(最外层广播，包括 size 比 x 多出的前导维)：整块复制 repeat 份。
+    // repeat 份按核均分；块能放进 UB 时只读一次，在 UB 内倍增成多份后整段写出，不再逐行走 performTileBroadcast。
+    __aicore__ inline void performBlockReplicate(int tile_idx)
+    {
+        int32_t block = this->inner[tile_idx];
+        int32_t repeat = this->repeater[tile_idx];
+        int32_t per_core = (repeat + this->blockStride - 1) / this->blockStride;
+        int32_t r_begin = per_core * this->blockIdx;
+        int32_t rows = min(per_core, repeat - r_begin);
+        if (rows <= 0) return;
+        int32_t out_base = r_begin * block;
+        if (block > this->ub_buf_elems || block * (int32_t)sizeof(T) <= 32)
+        {
+            // 大块按 chunk 走原路径；不超过 32B 的小块原路径已经做了倍增
+            performRowBroadcast(0, out_base, block, rows);
+            return;
+        }
+        copyIn(0, 0, block);
+        auto vecbuf = Queue.DeQue<T>();
+        int32_t filled = block;
+        int32_t all = min(this->ub_buf_elems, rows * block);
+        if (block % this->align_elems != 0)
+            MyFillPad(vecbuf, filled);
+        if (filled % this->align_elems == 0)
+            while (filled * 2 <= all)
+            {
+                MyCopy(vecbuf, filled);
+                filled <<= 1;
+            }
+        Queue.EnQue<T>(vecbuf);
+        copyOut(out_base, 0, block, filled, rows, block);
+    }
+    // 非连续输入的第一级广播：行内只有一个连续块时沿用普通路径，只换行首地址；
+    // 否则用 DataCopyPad(blockCount=row_blocks, srcStride=block_gap) 一次把整行 gather 进 UB，
+    // 再以相同的块形状、dstStride=0 紧密写出 repeat 份，gather 与广播合在同一次搬运里完成。
+    __aicore__ inline void performStridedTileBroadcast(int32_t outer_index)
+    {
+        int32_t inner_elems = this->inner[0];
+        int32_t repeat = this->repeater[0];
+        int32_t in_base = compute_strided_in_base(outer_index);
+        int32_t out_base = compute_out_base(0, outer_index);
+        if (this->row_blocks == 1)
+        {
+            performRowBroadcast(in_base, out_base, inner_elems, repeat);
+            return;
+        }
+        DataCopyExtParams cp_in{static_cast<uint16_t>(this->row_blocks), static_cast<uint32_t>(this->block_len * sizeof(T)),
+                                static_cast<uint32_t>(this->block_gap * sizeof(T)), 0, 0};
+        DataCopyExtParams cp_out{static_cast<uint16_t>(this->row_blocks), static_cast<uint32_t>(this->block_len * sizeof(T)), 0, 0, 0};
+        auto buf = Queue.AllocTensor<T>();
+        DataCopyPad(buf, srcGm[in_base], cp_in, {0, 0, 0, 0});
+        Queue.EnQue<T>(buf);
+        buf = Queue.DeQue<T>();
+        for (int32_t i = 0; i < repeat; i++)
+            DataCopyPad(dstGm[out_base + i * inner_elems], buf, cp_out);
+        Queue.FreeTensor<T>(buf);
+    }
     __aicore__ inline void MyDataCopyPadOut(LocalTensor<T> &vecbuf,int32_t dst_offset, int32_t elems)
     {
         DataCopyExtParams copyParams{1, static_cast<uint32_t>(elems * sizeof(T)), 0, 0, 0};
@@ -291,6 +385,13 @@ private:
     int32_t outer[3];
     int32_t repeater[3];
     int32_t inner[3];
+    int32_t strided;
+    int32_t row_blocks;
+    int32_t block_len;
+    int32_t block_gap;
+    int32_t outer_rank;
+    int32_t outer_dims[8];
+    int32_t outer_strides[8];
     int32_t outputsize;
     int32_t tiling_size;
     int32_t total_outer_repeats;
@@ -0,0 +1,352 @@
+#include "kernel_operator.h"
+#include <type_traits>
+using namespace AscendC;
+
+/*
+ * Expand 的反向：dy 按 Expand 的广播分解(见 op_host/expand_layout.h)在广播轴上求和，一次遍历直接写出 dx，
+ * 不经过逐级求和的中间 workspace。fp16/bf16 搬入后转 fp32 累加，写回时再转回。
+ *   tiling key 0(末组为保留组)：平面内 rows 行、每行 cols 个连续元素逐行累加；最内层广播组内
+ *     row_batch 行等距，一次 DataCopyPad 搬入，在 UB 中按子行分别累加，最后按固定顺序折叠。
+ *   tiling key 1(末组为广播组)：每个输出是若干段长 seg_len 的连续元素之和；只有一段且段短时一次搬入
+ *     short_batch 个输出的段，WholeReduceSum 每个 repeat 归约一个。
+ * 工作项够分核时每个输出只由一个核计算；不够时(row_parts > 1)每个工作项的累加行再切成 row_parts 段，
+ * 各段的 fp32 部分和写到 workspace 的第 part 片，SyncAll 后输出按核切分，各片按段号升序相加后写回。
+ * 两种方式的累加顺序都只取决于 tiling，多核结果可复现。
+ */
+template <typename T>
+class KernelReduceSumToShape
+{
+public:
+    static constexpr uint32_t MAX_GROUPS = 4;
+    static constexpr uint32_t WORK_BYTES = 4096;  // ReduceSum 工作区
+
+    __aicore__ inline KernelReduceSumToShape() {}
+    __aicore__ inline void Init(GM_ADDR dy, GM_ADDR dx, GM_ADDR workspace, const ReduceSumToShapeTilingData &t,
+                                TPipe *pipe_ptr)
+    {
+        pipe = pipe_ptr;
+        blockIdx = GetBlockIdx();
+        blockNum = GetBlockNum();
+        outputs = t.outputs;
+        rows = t.rows;
+        cols = t.cols;
+        segLen = t.seg_len;
+        outerRank = t.outer_rank;
+        redRank = t.red_rank;
+        for (uint32_t i = 0; i < MAX_GROUPS; ++i) {
+            outerDims[i] = t.outer_dims[i];
+            outerStrides[i] = t.outer_strides[i];
+            redDims[i] = t.red_dims[i];
+            redStrides[i] = t.red_strides[i];
+        }
+        tileElems = t.tile_elems;
+        colTile = t.col_tile;
+        rowBatch = t.row_batch;
+        shortBatch = t.short_batch;
+        rowParts = t.row_parts;
+        partRows = t.part_rows;
+        dyGm.SetGlobalBuffer(reinterpret_cast<__gm__ T *>(dy), t.total);
+        dxGm.SetGlobalBuffer(reinterpret_cast<__gm__ T *>(dx), outputs);
+        if (rowParts > 1) {
+            partGm.SetGlobalBuffer(reinterpret_cast<__gm__ float *>(GetUserWorkspace(workspace)), rowParts * outputs);
+        }
+
+        // 与 host 的 BytesPerElem 一致
+        pipe->InitBuffer(inQueue, 2, tileElems * sizeof(T));
+        pipe->InitBuffer(outQueue, 1, tileElems * sizeof(T));
+        pipe->InitBuffer(bufAcc, tileElems * sizeof(float));
+        if constexpr (!std::is_same<T, float>::value) {
+            pipe->InitBuffer(bufCast, tileElems * sizeof(float));
+        }
+        if (TILING_KEY_IS(1)) {
+            pipe->InitBuffer(bufWork, WORK_BYTES);
+            pipe->InitBuffer(bufRes, 32);
+        }
+    }
+
+    __aicore__ inline void Process()
+    {
+        if (rowParts > 1) {
+            ProcessParts();
+            return;
+        }
+        if (TILING_KEY_IS(0)) {
+            const uint32_t chunks = (cols + colTile - 1) / colTile;
+            const uint32_t items = outputs / cols * chunks;
+            for (uint32_t it = blockIdx; it < items; it += blockNum) {
+                const uint32_t plane = it / chunks;
+                const uint32_t off = (it % chunks) * colTile;
+                const uint32_t len = Min(colTile, cols - off);
+                auto acc = ReducePlaneColumns(MixedOffset(plane, outerRank, outerDims, outerStrides) + off,
+                                              len, 0, rows);
+                CopyOutSums(acc, plane * cols + off, len);
+            }
+        } else if (TILING_KEY_IS(1)) {
+            // 输出按核连续切分，攒满一批再一次写回
+            const uint32_t per = (outputs + blockNum - 1) / blockNum;
+            const uint32_t begin = blockIdx * per;
+            const uint32_t end = Min(outputs, begin + per);
+            uint32_t k;
+            for (uint32_t s = begin; s < end; s += k) {
+                if (shortBatch != 0) {
+                    k = Min(shortBatch, end - s);
+                    ReduceShortSlices(s, k);
+                } else {
+                    k = Min(tileElems, end - s);
+                    ReduceSlices(s, k);
+                }
+            }
+        }
+    }
+
+private:
+    /* 切行分核：第一阶段每个 (工作项, 段) 求部分和写到 workspace，第二阶段按段号顺序合并 */
+    __aicore__ inline void ProcessParts()
+    {
+        if (TILING_KEY_IS(0)) {
+            const uint32_t chunks = (cols + colTile - 1) / colTile;
+            const uint32_t items = outputs / cols * chunks * rowParts;
+            for (uint32_t it = blockIdx; it < items; it += blockNum) {
+                const uint32_t unit = it / rowParts;
+                const uint32_t part = it % rowParts;
+                const uint32_t plane = unit / chunks;
+                const uint32_t off = (unit % chunks) * colTile;
+                const uint32_t len = Min(colTile, cols - off);
+                const uint32_t r0 = part * partRows;
+                auto acc = ReducePlaneColumns(MixedOffset(plane, outerRank, outerDims, outerStrides) + off,
+                                              len, r0, Min(rows, r0 + partRows));
+                WaitEvent<HardEvent::V_MTE3>();
+                DataCopyPad(partGm[part * outputs + plane * cols + off], acc,
+                            {1, static_cast<uint32_t>(len * sizeof(float)), 0, 0, 0});
+                WaitEvent<HardEvent::MTE3_V>();  // 下一个工作项清零 acc 前等写出完成
+            }
+        } else if (TILING_KEY_IS(1)) {
+            auto sums = bufAcc.Get<float>();
+            const uint32_t items = outputs * rowParts;
+            for (uint32_t it = blockIdx; it < items; it += blockNum) {
+                const uint32_t s = it / rowParts;
+                const uint32_t part = it % rowParts;
+                const uint32_t e0 = part * partRows;
+                sums.SetValue(0, SliceSum(MixedOffset(s, outerRank, outerDims, outerStrides), e0,
+                                          Min(rows, e0 + partRows)));
+                WaitEvent<HardEvent::S_MTE3>();
+                DataCopyPad(partGm[part * outputs + s], sums, {1, static_cast<uint32_t>(sizeof(float)), 0, 0, 0});
+                WaitEvent<HardEvent::MTE3_S>();
+            }
+        }
+        SyncAll();
+        FoldParts();
+    }
+
+    // 输出按核连续切分，每块从第 0 片起按段号升序相加，与部分和由哪个核算出无关
+    __aicore__ inline void FoldParts()
+    {
+        const uint32_t per = (outputs + blockNum - 1) / blockNum;
+        const uint32_t begin = blockIdx * per;
+        const uint32_t end = Min(outputs, begin + per);
+        const uint32_t foldElems = tileElems * sizeof(T) / sizeof(float);  // 输入缓冲能放下的 fp32 个数
+        auto acc = bufAcc.Get<float>();
+        uint32_t n;
+        for (uint32_t s = begin; s < end; s += n) {
+            n = Min(foldElems, end - s);
+            Duplicate(acc, 0.0f, n);
+            for (uint32_t part = 0; part < rowParts; ++part) {
+                auto t = inQueue.AllocTensor<float>();
+                DataCopyPad(t, partGm[part * outputs + s], {1, static_cast<uint32_t>(n * sizeof(float)), 0, 0, 0},
+                            {false, 0, 0, 0});
+                inQueue.EnQue(t);
+                t = inQueue.DeQue<float>();
+                Add(acc, acc, t, n);
+                inQueue.FreeTensor(t);
+            }
+            CopyOutSums(acc, s, n);
+        }
+    }
+
+    __aicore__ static inline uint32_t Min(uint32_t a, uint32_t b) { return a < b ? a : b; }
+    __aicore__ static inline uint32_t RoundUp(uint32_t n, uint32_t a) { return (n + a - 1) / a * a; }
+
+    /* 编号 n 按 dims(高维在前)展开成元素偏移 */
+    __aicore__ static inline uint32_t MixedOffset(uint32_t n, uint32_t rank,
+                                                  const uint32_t *dims, const uint32_t *strides)
+    {
+        if (rank == 1) return n * strides[0];
+        uint32_t off = 0;
+        for (int32_t i = static_cast<int32_t>(rank) - 1; i >= 0; --i) {
+            off += (n % dims[i]) * strides[i];
+            n /= dims[i];
+        }
+        return off;
+    }
+
+    template <HardEvent EVT>
+    __aicore__ inline void WaitEvent()
+    {
+        event_t e = static_cast<event_t>(pipe->FetchEventID(EVT));
+        SetFlag<EVT>(e);
+        WaitFlag<EVT>(e);
+    }
+
+    /* 搬入的 tile 转成 fp32；float 直接复用输入缓冲 */
+    __aicore__ inline LocalTensor<float> ToFloat(LocalTensor<T> &t, uint32_t n)
+    {
+        if constexpr (std::is_same<T, float>::value) {
+            return t;
+        } else {
+            auto f = bufCast.Get<float>();
+            Cast(f, t, RoundMode::CAST_NONE, n);
+            return f;
+        }
+    }
+
+    /* n 个 fp32 结果转回 T 写到 dx[outPos] */
+    __aicore__ inline void CopyOutSums(LocalTensor<float> &sums, uint32_t outPos, uint32_t n)
+    {
+        auto o = outQueue.AllocTensor<T>();
+        if constexpr (std::is_same<T, float>::value) {
+            Adds(o, sums, 0.0f, n);
+        } else {
+            Cast(o, sums, RoundMode::CAST_RINT, n);
+        }
+        outQueue.EnQue(o);
+        o = outQueue.DeQue<T>();
+        DataCopyPad(dxGm[outPos], o, {1, static_cast<uint32_t>(n * sizeof(T)), 0, 0, 0});
+        outQueue.FreeTensor(o);
+    }
+
+    /* --- 平面路径 --- */
+    // 第 q 组(最内层以外的广播下标)、最内层从 b 开始的至多 rowBatch 行(且不超过 left 行)，子行在 UB 中间隔 pad 个元素
+    __aicore__ inline uint32_t RowCopyIn(uint32_t inBase, uint32_t q, uint32_t b, uint32_t left, uint32_t len,
+                                         uint32_t pad)
+    {
+        const uint32_t innerRows = redRank == 0 ? 1 : redDims[redRank - 1];
+        const uint32_t innerStride = redRank == 0 ? 0 : redStrides[redRank - 1];
+        const uint32_t k = Min(Min(rowBatch, innerRows - b), left);
+        const uint32_t gmPos = inBase + MixedOffset(q, redRank == 0 ? 0 : redRank - 1, redDims, redStrides) +
+                               b * innerStride;
+        const uint32_t rowBytes = len * sizeof(T);
+        auto t = inQueue.AllocTensor<T>();
+        DataCopyExtParams cp{static_cast<uint16_t>(k), rowBytes,
+                             k > 1 ? static_cast<uint32_t>((innerStride - len) * sizeof(T)) : 0,
+                             (pad * static_cast<uint32_t>(sizeof(T)) - RoundUp(rowBytes, 32)) / 32, 0};
+        DataCopyPad(t, dyGm[gmPos], cp, {false, 0, 0, 0});
+        inQueue.EnQue(t);
+        return k;
+    }
+
+    __aicore__ inline void RowAccumulate(LocalTensor<float> &acc, uint32_t n)
+    {
+        auto t = inQueue.DeQue<T>();
+        auto f = ToFloat(t, n);
+        Add(acc, acc, f, n);
+        inQueue.FreeTensor(t);
+    }
+
+    // 行号 r = q * innerRows + b，累加 [r0, r1) 行的 len 列，结果在返回的 acc 前 len 个元素
+    __aicore__ inline LocalTensor<float> ReducePlaneColumns(uint32_t inBase, uint32_t len, uint32_t r0, uint32_t r1)
+    {
+        const uint32_t pad = RoundUp(len, 16);
+        const uint32_t innerRows = redRank == 0 ? 1 : redDims[redRank - 1];
+        auto acc = bufAcc.Get<float>();
+        Duplicate(acc, 0.0f, rowBatch * pad);
+
+        // 双缓冲：先发下一批的搬入再累加当前批
+        uint32_t r = r0;
+        uint32_t k = RowCopyIn(inBase, r / innerRows, r % innerRows, r1 - r, len, pad);
+        while (true) {
+            const uint32_t nr = r + k;
+            uint32_t nk = nr < r1 ? RowCopyIn(inBase, nr / innerRows, nr % innerRows, r1 - nr, len, pad) : 0;
+            RowAccumulate(acc, k * pad);
+            if (nr == r1) break;
+            r = nr;
+            k = nk;
+        }
+        for (uint32_t i = 1; i < rowBatch; ++i) {
+            Add(acc, acc, acc[i * pad], pad);
+        }
+        return acc;
+    }
+
+    /* --- slice 路径 --- */
+    // 只有一段、段长 <= 64：k 个输出的段一次搬入，每段在 UB 中按 32B 对齐，WholeReduceSum 每个 repeat 求一个输出
+    __aicore__ inline void ReduceShortSlices(uint32_t s, uint32_t k)
+    {
+        const uint32_t rowBytes = segLen * sizeof(T);
+        const uint32_t padT = RoundUp(rowBytes, 32) / sizeof(T);
+        auto t = inQueue.AllocTensor<T>();
+        DataCopyPad(t, dyGm[MixedOffset(s, outerRank, outerDims, outerStrides)],
+                    {static_cast<uint16_t>(k), rowBytes, 0, 0, 0}, {false, 0, 0, 0});
+        inQueue.EnQue(t);
+        t = inQueue.DeQue<T>();
+        auto f = ToFloat(t, k * padT);
+        auto sums = bufAcc.Get<float>();
+        WholeReduceSum<float>(sums, f, static_cast<int32_t>(segLen), static_cast<int32_t>(k), 1, 1,
+                              static_cast<int32_t>(padT * sizeof(float) / 32));
+        inQueue.FreeTensor(t);
+        CopyOutSums(sums, s, k);
+    }
+
+    // 起点为 base 的输出中第 [e0, e1) 个元素(逐段首尾相接编号)之和，按段、按 tile 以 fp32 标量按固定顺序累加
+    __aicore__ inline float SliceSum(uint32_t base, uint32_t e0, uint32_t e1)
+    {
+        auto res = bufRes.Get<float>();
+        auto work = bufWork.Get<float>();
+        float sum = 0.0f;
+        uint32_t chunk;
+        for (uint32_t e = e0; e < e1; e += chunk) {
+            const uint32_t done = e % segLen;
+            chunk = Min(Min(tileElems, segLen - done), e1 - e);
+            const uint32_t pos = base + MixedOffset(e / segLen, redRank, redDims, redStrides) + done;
+            auto t = inQueue.AllocTensor<T>();
+            DataCopyPad(t, dyGm[pos], {1, static_cast<uint32_t>(chunk * sizeof(T)), 0, 0, 0}, {false, 0, 0, 0});
+            inQueue.EnQue(t);
+            t = inQueue.DeQue<T>();
+            auto f = ToFloat(t, chunk);
+            ReduceSum(res, f, work, chunk);
+            inQueue.FreeTensor(t);
+            WaitEvent<HardEvent::V_S>();
+            sum += res.GetValue(0);
+        }
+        return sum;
+    }
+
+    // 一般情况：逐个输出求和，k 个结果攒在 UB 中一次写回
+    __aicore__ inline void ReduceSlices(uint32_t s, uint32_t k)
+    {
+        auto sums = bufAcc.Get<float>();
+        for (uint32_t i = 0; i < k; ++i) {
+            sums.SetValue(i, SliceSum(MixedOffset(s + i, outerRank, outerDims, outerStrides), 0, rows));
+        }
+        WaitEvent<HardEvent::S_V>();
+        CopyOutSums(sums, s, k);
+        WaitEvent<HardEvent::V_S>();  // 下一批写 sums 前等本批 Cast 读完
+    }
+
+    GlobalTensor<T> dyGm;
+    GlobalTensor<T> dxGm;
+    GlobalTensor<float> partGm;        // 切行分核时各段的部分和，第 part 片占 outputs 个
+    TPipe *pipe;
+    TQue<TPosition::VECIN, 2> inQueue;
+    TQue<TPosition::VECOUT, 1> outQueue;
+    TBuf<TPosition::VECCALC> bufAcc;   // 平面路径的 fp32 累加 / slice 路径的结果
+    TBuf<TPosition::VECCALC> bufCast;
+    TBuf<TPosition::VECCALC> bufWork;
+    TBuf<TPosition::VECCALC> bufRes;
+
+    uint32_t blockIdx, blockNum;
+    uint32_t outputs, rows, cols, segLen;
+    uint32_t outerRank, redRank;
+    uint32_t outerDims[MAX_GROUPS], outerStrides[MAX_GROUPS];
+    uint32_t redDims[MAX_GROUPS], redStrides[MAX_GROUPS];
+    uint32_t tileElems, colTile, rowBatch, shortBatch;
+    uint32_t rowParts, partRows;
+};
+
+extern "C" __global__ __aicore__ void reduce_sum_to_shape(GM_ADDR x, GM_ADDR y, GM_ADDR workspace, GM_ADDR tiling)
+{
+    GET_TILING_DATA(tilingData, tiling);
+    TPipe pipe;
+    KernelReduceSumToShape<DTYPE_X> op;
+    op.Init(x, y, workspace, tilingData, &pipe);
+    op.Process();
+}
@@ -0,0 +1,157 @@
+#ifndef ASCEND_OPS_LAUNCH_TRACE_H
+#define ASCEND_OPS_LAUNCH_TRACE_H
+/*
+ * 启动现场抓取 / 回放用的二进制格式。
+ * host 侧 TilingFunc 在设置了 ASCEND_OPS_TRACE_DIR 时把本次 launch 的 tiling、输入 shape/dtype、
+ * 属性(以及可选的输入数据)写成一个 .trace 文件；tools/replay 读回后在 CPU 孪生调试模式下重跑同一 launch。
+ * 本头文件不依赖 CANN 头文件，host 算子与离线工具共用。
+ *
+ * 文件布局(小端)：
+ *   TraceHeader
+ *   int64_t dims[rank]            输入 shape
+ *   int64_t attrs[attr_count]     属性，按算子约定展平(见各算子 CaptureTrace)
+ *   uint8_t tiling[tiling_size]   SaveToBuffer 后的 tiling 数据
+ *   uint8_t payload[payload_size] 输入数据，0 表示未抓取
+ */
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+namespace launch_trace {
+constexpr const char *TRACE_DIR_ENV   = "ASCEND_OPS_TRACE_DIR";   // 输出目录，未设置则不抓取
+constexpr const char *TRACE_INPUT_ENV = "ASCEND_OPS_TRACE_INPUT"; // =1 时额外抓取输入数据(仅 host 侧可见时)
+constexpr uint32_t TRACE_VERSION = 1;
+constexpr char TRACE_MAGIC[8] = {'A', 'S', 'C', 'T', 'R', 'A', 'C', 'E'};
+
+enum TraceOp : uint32_t {
+    TRACE_OP_EXPAND  = 1,
+    TRACE_OP_ARG_MIN = 2,
+};
+
+#pragma pack(push, 1)
+struct TraceHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t op;            // TraceOp
+    int32_t  dtype;         // ge::DataType 枚举值
+    int32_t  format;        // ge::Format 枚举值
+    uint32_t rank;
+    uint32_t attr_count;
+    uint64_t tiling_key;
+    uint32_t block_dim;
+    uint32_t tiling_size;
+    uint64_t workspace_size;
+    uint64_t payload_size;
+};
+#pragma pack(pop)
+
+struct TraceRecord {
+    uint32_t op = 0;
+    int32_t  dtype = 0;
+    int32_t  format = 0;
+    uint64_t tilingKey = 0;
+    uint32_t blockDim = 1;
+    uint64_t workspaceSize = 0;
+    std::vector<int64_t> dims;
+    std::vector<int64_t> attrs;
+    std::vector<uint8_t> tiling;
+    std::vector<uint8_t> payload;
+};
+
+inline const char *TraceDir()
+{
+    const char *dir = std::getenv(TRACE_DIR_ENV);
+    return (dir != nullptr && dir[0] != '\0') ? dir : nullptr;
+}
+
+inline bool TraceInputEnabled()
+{
+    const char *v = std::getenv(TRACE_INPUT_ENV);
+    return v != nullptr && v[0] == '1';
+}
+
+/* 从 TilingContext 取 launch 相关的公共部分；模板化以免本头文件依赖 gert 头文件 */
+template <typename TilingContextT>
+inline void FillLaunch(TraceRecord &rec, TilingContextT *context)
+{
+    auto *raw = context->GetRawTilingData();
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(raw->GetData());
+    rec.tiling.assign(data, data + raw->GetDataSize());
+    rec.tilingKey = context->GetTilingKey();
+    rec.blockDim  = context->GetBlockDim();
+    rec.workspaceSize = 0;
+    size_t wsNum = context->GetWorkspaceNum();
+    if (wsNum > 0) {
+        const size_t *ws = context->GetWorkspaceSizes(wsNum);
+        for (size_t i = 0; ws != nullptr && i < wsNum; ++i) rec.workspaceSize += ws[i];
+    }
+}
+
+inline bool WriteTrace(const TraceRecord &rec, const char *opName)
+{
+    const char *dir = TraceDir();
+    if (dir == nullptr) return false;
+    static std::atomic<uint32_t> seq{0};
+    std::string path = std::string(dir) + "/" + opName + "_" + std::to_string(getpid()) + "_" +
+                       std::to_string(seq.fetch_add(1)) + ".trace";
+    FILE *fp = std::fopen(path.c_str(), "wb");
+    if (fp == nullptr) return false;
+
+    TraceHeader h;
+    std::memcpy(h.magic, TRACE_MAGIC, sizeof(h.magic));
+    h.version        = TRACE_VERSION;
+    h.op             = rec.op;
+    h.dtype          = rec.dtype;
+    h.format         = rec.format;
+    h.rank           = static_cast<uint32_t>(rec.dims.size());
+    h.attr_count     = static_cast<uint32_t>(rec.attrs.size());
+    h.tiling_key     = rec.tilingKey;
+    h.block_dim      = rec.blockDim;
+    h.tiling_size    = static_cast<uint32_t>(rec.tiling.size());
+    h.workspace_size = rec.workspaceSize;
+    h.payload_size   = rec.payload.size();
+
+    bool ok = std::fwrite(&h, sizeof(h), 1, fp) == 1;
+    ok = ok && std::fwrite(rec.dims.data(), sizeof(int64_t), rec.dims.size(), fp) == rec.dims.size();
+    ok = ok && std::fwrite(rec.attrs.data(), sizeof(int64_t), rec.attrs.size(), fp) == rec.attrs.size();
+    ok = ok && std::fwrite(rec.tiling.data(), 1, rec.tiling.size(), fp) == rec.tiling.size();
+    ok = ok && std::fwrite(rec.payload.data(), 1, rec.payload.size(), fp) == rec.payload.size();
+    std::fclose(fp);
+    return ok;
+}
+
+inline bool ReadTrace(const char *path, TraceRecord &rec)
+{
+    FILE *fp = std::fopen(path, "rb");
+    if (fp == nullptr) return false;
+    TraceHeader h;
+    bool ok = std::fread(&h, sizeof(h), 1, fp) == 1 &&
+              std::memcmp(h.magic, TRACE_MAGIC, sizeof(h.magic)) == 0 &&
+              h.version == TRACE_VERSION;
+    if (ok) {
+        rec.op            = h.op;
+        rec.dtype         = h.dtype;
+        rec.format        = h.format;
+        rec.tilingKey     = h.tiling_key;
+        rec.blockDim      = h.block_dim;
+        rec.workspaceSize = h.workspace_size;
+        rec.dims.resize(h.rank);
+        rec.attrs.resize(h.attr_count);
+        rec.tiling.resize(h.tiling_size);
+        rec.payload.resize(h.payload_size);
+        ok = std::fread(rec.dims.data(), sizeof(int64_t), h.rank, fp) == h.rank &&
+             std::fread(rec.attrs.data(), sizeof(int64_t), h.attr_count, fp) == h.attr_count &&
+             std::fread(rec.tiling.data(), 1, h.tiling_size, fp) == h.tiling_size &&
+             std::fread(rec.payload.data(), 1, h.payload_size, fp) == h.payload_size;
+    }
+    std::fclose(fp);
+    return ok;
+}
+} // namespace launch_trace
+
+#endif // ASCEND_OPS_LAUNCH_TRACE_H
@@ -0,0 +1,197 @@
+#ifndef ASCEND_OPS_TILING_CACHE_H
+#define ASCEND_OPS_TILING_CACHE_H
+/*
+ * host 侧 tiling 结果缓存。
+ * 动态 shape 推理中少量 shape 签名占了绝大多数 launch，TilingFunc 每次重新做轴合并、dtype 换算和序列化
+ * 对小 kernel 是可见的开销。这里按 (输入 shape/dtype/format, 属性, SoC, 核数) 序列化出的 key 缓存
+ * SaveToBuffer 之后的 tiling 字节、block dim、tiling key 和 workspace 大小，命中时直接写回 context。
+ *
+ * 容量由 ASCEND_OPS_TILING_CACHE_SIZE 指定(条目数，默认 DEFAULT_CAPACITY，0 关闭缓存)，满了按 LRU 淘汰。
+ * 查找/插入持锁，计数器无锁；每个算子一个实例，命中率通过 TILING_CACHE_EXPORT_STATS 导出的 C 接口读取。
+ * 与 launch_trace.h 一样不依赖 CANN 头文件，context 相关的部分模板化。
+ */
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tiling_cache {
+constexpr const char *CAPACITY_ENV = "ASCEND_OPS_TILING_CACHE_SIZE";
+constexpr size_t DEFAULT_CAPACITY = 256;
+
+struct Entry {
+    std::vector<uint8_t> tiling;
+    uint64_t tilingKey = 0;
+    uint32_t blockDim = 1;
+    std::vector<size_t> workspace;
+};
+
+/* 定长字段直接按字节拼接；变长部分先写长度，避免不同 shape 拼出相同的 key */
+class KeyBuilder {
+public:
+    KeyBuilder &Add(int64_t v)
+    {
+        key_.append(reinterpret_cast<const char *>(&v), sizeof(v));
+        return *this;
+    }
+
+    template <typename ShapeT>
+    KeyBuilder &AddShape(const ShapeT &s)
+    {
+        Add(static_cast<int64_t>(s.GetDimNum()));
+        for (size_t i = 0; i < s.GetDimNum(); ++i) Add(s.GetDim(i));
+        return *this;
+    }
+
+    // ListInt 属性，nullptr 与空列表等价
+    template <typename ListT>
+    KeyBuilder &AddList(const ListT *l)
+    {
+        const size_t n = l == nullptr ? 0 : l->GetSize();
+        Add(static_cast<int64_t>(n));
+        for (size_t i = 0; i < n; ++i) Add(l->GetData()[i]);
+        return *this;
+    }
+
+    const std::string &Str() const { return key_; }
+
+private:
+    std::string key_;
+};
+
+class TilingCache {
+public:
+    explicit TilingCache(size_t capacity) : capacity_(capacity) {}
+
+    bool Enabled() const { return capacity_ > 0; }
+
+    // tiling 超过 maxTilingBytes 的条目当前 context 放不下，按未命中计数
+    bool Lookup(const std::string &key, Entry &out, size_t maxTilingBytes = SIZE_MAX)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            auto it = index_.find(key);
+            if (it != index_.end() && it->second->second.tiling.size() <= maxTilingBytes) {
+                lru_.splice(lru_.begin(), lru_, it->second);
+                out = it->second->second;
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    void Insert(const std::string &key, Entry e)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            // 并发未命中时另一线程已插入，结果相同，只刷新位置
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return;
+        }
+        lru_.emplace_front(key, std::move(e));
+        index_[key] = lru_.begin();
+        if (lru_.size() > capacity_) {
+            index_.erase(lru_.back().first);
+            lru_.pop_back();
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        lru_.clear();
+        index_.clear();
+    }
+
+    uint64_t Hits() const { return hits_.load(std::memory_order_relaxed); }
+    uint64_t Misses() const { return misses_.load(std::memory_order_relaxed); }
+    uint64_t Evictions() const { return evictions_.load(std::memory_order_relaxed); }
+
+    size_t Size()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        return lru_.size();
+    }
+
+private:
+    using Node = std::pair<std::string, Entry>;
+    const size_t capacity_;
+    std::mutex mu_;
+    std::list<Node> lru_;
+    std::unordered_map<std::string, std::list<Node>::iterator> index_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+    std::atomic<uint64_t> evictions_{0};
+};
+
+inline size_t CapacityFromEnv()
+{
+    const char *v = std::getenv(CAPACITY_ENV);
+    if (v == nullptr || v[0] == '\0') return DEFAULT_CAPACITY;
+    return static_cast<size_t>(std::strtoull(v, nullptr, 10));
+}
+
+/* 命中时把缓存的结果写回 context；tiling 缓冲容量不够时按未命中处理(只计一次 miss) */
+template <typename TilingContextT>
+inline bool Apply(TilingCache &cache, const std::string &key, TilingContextT *context)
+{
+    if (!cache.Enabled()) return false;
+    Entry e;
+    auto *raw = context->GetRawTilingData();
+    if (!cache.Lookup(key, e, raw->GetCapacity())) return false;
+    std::memcpy(raw->GetData(), e.tiling.data(), e.tiling.size());
+    raw->SetDataSize(e.tiling.size());
+    context->SetTilingKey(e.tilingKey);
+    context->SetBlockDim(e.blockDim);
+    if (!e.workspace.empty()) {
+        size_t *ws = context->GetWorkspaceSizes(e.workspace.size());
+        for (size_t i = 0; ws != nullptr && i < e.workspace.size(); ++i) ws[i] = e.workspace[i];
+    }
+    return true;
+}
+
+/* TilingFunc 成功后记录本次结果，取法与 launch_trace::FillLaunch 相同 */
+template <typename TilingContextT>
+inline void Store(TilingCache &cache, const std::string &key, TilingContextT *context)
+{
+    if (!cache.Enabled()) return;
+    Entry e;
+    auto *raw = context->GetRawTilingData();
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(raw->GetData());
+    e.tiling.assign(data, data + raw->GetDataSize());
+    e.tilingKey = context->GetTilingKey();
+    e.blockDim = context->GetBlockDim();
+    const size_t wsNum = context->GetWorkspaceNum();
+    const size_t *ws = wsNum > 0 ? context->GetWorkspaceSizes(wsNum) : nullptr;
+    if (ws != nullptr) e.workspace.assign(ws, ws + wsNum);
+    cache.Insert(key, std::move(e));
+}
+} // namespace tiling_cache
+
+/*
+ * 在算子的 host 源文件中导出命中计数，op_host 以 -fvisibility=hidden 编译，需显式 default 可见性：
+ *   extern "C" void <op>_tiling_cache_stats(uint64_t *hits, uint64_t *misses, uint64_t *evictions, uint64_t *size);
+ * 任一指针可为 nullptr。
+ */
+#define TILING_CACHE_EXPORT_STATS(op, cache)                                                              \
+    extern "C" __attribute__((visibility("default"))) void op##_tiling_cache_stats(                        \
+        uint64_t *hits, uint64_t *misses, uint64_t *evictions, uint64_t *size)                             \
+    {                                                                                                      \
+        tiling_cache::TilingCache &c = (cache);                                                            \
+        if (hits != nullptr) *hits = c.Hits();                                                             \
+        if (misses != nullptr) *misses = c.Misses();                                                       \
+        if (evictions != nullptr) *evictions = c.Evictions();                                              \
+        if (size != nullptr) *size = c.Size();                                                             \
+    }
+
+#endif // ASCEND_OPS_TILING_CACHE_H
@@ -0,0 +1,126 @@
+/*
+ * GroupedArgMin 的 CPU 孪生调试回归测试：手工构造 tiling，让同一组相邻的 slice 输出落在不同核上，
+ * 检查每个输出都与标量参考结果一致(各核的写回不能越过本工作项、也不能被邻核覆盖)。
+ * 用法: grouped_arg_min_test，全部通过时返回 0
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "tikicpulib.h"
+#include "replay_tiling.h"
+#include "../../Argmin/op_kernel/grouped_arg_min.cpp"
+
+namespace {
+struct Group {
+    uint32_t outer;
+    uint32_t inner;
+};
+
+/* 按 ListTensorDesc 的 GM 布局组 tensor 列表：[数据指针区偏移, 每个 tensor 的 (维数, dims...), 数据指针...] */
+uint8_t *MakeTensorList(const std::vector<Group> &groups, const std::vector<void *> &ptrs)
+{
+    std::vector<uint64_t> words(1);
+    for (const Group &g : groups) {
+        words.push_back(2);
+        words.push_back(g.outer);
+        words.push_back(g.inner);
+    }
+    words[0] = words.size() * sizeof(uint64_t);
+    for (void *p : ptrs) words.push_back(reinterpret_cast<uint64_t>(p));
+    auto *buf = static_cast<uint8_t *>(AscendC::GmAlloc(words.size() * sizeof(uint64_t)));
+    std::memcpy(buf, words.data(), words.size() * sizeof(uint64_t));
+    return buf;
+}
+} // namespace
+
+int main()
+{
+    // 两组都走连续 slice 路径；第 0 组的 5 个输出拆成两个工作项分给两个核，
+    // 核 0 写 [0, 2)、核 1 写 [2, 5)，输出 1 与 2 相邻且同在一个 cache line 内
+    const std::vector<Group> groups = {{5, 24}, {3, 40}};
+    const uint32_t blockDim = 2;
+
+    GroupedArgMinTilingData td;
+    std::memset(&td, 0, sizeof(td));
+    td.group_num = static_cast<uint32_t>(groups.size());
+    for (size_t g = 0; g < groups.size(); ++g) {
+        td.inner[g] = groups[g].inner;
+        td.outer[g] = groups[g].outer;
+        td.stride_m[g] = 1;
+    }
+    const uint32_t items[][3] = {{0, 0, 2}, {0, 2, 3}, {1, 0, 3}};  // (组, 起始 slice, slice 数)
+    td.item_num = 3;
+    td.slice_item_num = 3;
+    for (uint32_t i = 0; i < td.item_num; ++i) {
+        td.item_group[i] = items[i][0];
+        td.item_begin[i] = items[i][1];
+        td.item_count[i] = items[i][2];
+    }
+    td.core_item_begin[0] = 0;
+    td.core_item_begin[1] = 1;
+    td.core_item_begin[2] = 3;
+
+    std::vector<void *> xPtrs, yPtrs;
+    std::vector<std::vector<int64_t>> expect(groups.size());
+    uint64_t state = 0x9e3779b97f4a7c15ull;
+    for (size_t g = 0; g < groups.size(); ++g) {
+        const Group &gr = groups[g];
+        auto *x = static_cast<float *>(AscendC::GmAlloc(gr.outer * gr.inner * sizeof(float) + 32));
+        auto *y = static_cast<int64_t *>(AscendC::GmAlloc(gr.outer * sizeof(int64_t) + 32));
+        for (uint32_t s = 0; s < gr.outer; ++s) {
+            for (uint32_t i = 0; i < gr.inner; ++i) {
+                state = state * 6364136223846793005ull + 1442695040888963407ull;
+                x[s * gr.inner + i] = static_cast<float>(state >> 40) / static_cast<float>(1u << 24) + 1.0f;
+            }
+            // 每个 slice 的最小值放在不同位置
+            const uint32_t at = (s * 7 + g * 3) % gr.inner;
+            x[s * gr.inner + at] = -1.0f - static_cast<float>(s);
+            expect[g].push_back(at);
+        }
+        std::memset(y, 0xff, gr.outer * sizeof(int64_t) + 32);
+        xPtrs.push_back(x);
+        yPtrs.push_back(y);
+    }
+    uint8_t *xList = MakeTensorList(groups, xPtrs);
+    uint8_t *yList = MakeTensorList(groups, yPtrs);
+    uint8_t *ws = static_cast<uint8_t *>(AscendC::GmAlloc(32));
+    uint8_t *tiling = static_cast<uint8_t *>(AscendC::GmAlloc(sizeof(td)));
+    std::memcpy(tiling, &td, sizeof(td));
+
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_RUN_KF(grouped_arg_min, blockDim, xList, yList, ws, tiling);
+
+    int failures = 0;
+    for (size_t g = 0; g < groups.size(); ++g) {
+        const auto *y = static_cast<const int64_t *>(yPtrs[g]);
+        for (uint32_t s = 0; s < groups[g].outer; ++s) {
+            if (y[s] != expect[g][s]) {
+                std::fprintf(stderr, "group %zu slice %u: got %lld, expect %lld\n", g, s,
+                             static_cast<long long>(y[s]), static_cast<long long>(expect[g][s]));
+                ++failures;
+            }
+        }
+        // 输出之后的填充不能被写到
+        const auto *tail = reinterpret_cast<const uint8_t *>(y + groups[g].outer);
+        for (int b = 0; b < 32; ++b) {
+            if (tail[b] != 0xff) {
+                std::fprintf(stderr, "group %zu: write past the last output\n", g);
+                ++failures;
+                break;
+            }
+        }
+    }
+
+    for (size_t g = 0; g < groups.size(); ++g) {
+        AscendC::GmFree(xPtrs[g]);
+        AscendC::GmFree(yPtrs[g]);
+    }
+    AscendC::GmFree(xList);
+    AscendC::GmFree(yList);
+    AscendC::GmFree(ws);
+    AscendC::GmFree(tiling);
+    std::printf("grouped_arg_min_test: %s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,253 @@
+/*
+ * 离线回放 host 侧抓取的 launch(见 common/launch_trace.h)。
+ * 每个可执行文件对应一个 (算子, DTYPE_X[, DTYPE_Y])，由 CMake 的 REPLAY_OP / REPLAY_DTYPE / REPLAY_IDX_DTYPE 决定。
+ *
+ * 用法: launch_replay <file.trace> [--repeat N] [--seed S] [--input x.bin] [--mask m.bin] [--output y.bin]
+ *   --repeat  连续回放次数，打印每次 launch 的平均耗时(CPU 孪生调试下的墙钟时间)
+ *   --seed    trace 未带输入数据且未指定 --input 时，用该种子生成输入
+ *   --input   用外部文件作为输入(覆盖 trace 内的数据)
+ *   --mask    ArgMin 掩码输入(bool 每元素 1 字节，mask_bitpacked 时每字节 8 个元素)；trace 不带掩码数据，
+ *             带掩码的 launch 必须给出，否则拒绝回放
+ *   --output  把最后一次 launch 的输出写到文件，便于和 NPU 结果比对
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "tikicpulib.h"
+#include "../../common/launch_trace.h"
+#include "replay_tiling.h"
+
+#if defined(REPLAY_OP_EXPAND)
+#include "../../Expand/op_kernel/expand.cpp"
+#define REPLAY_KERNEL   expand
+#define REPLAY_TRACE_OP launch_trace::TRACE_OP_EXPAND
+#elif defined(REPLAY_OP_ARG_MIN)
+#ifndef DTYPE_Y
+#define DTYPE_Y int64_t
+#endif
+#include "../../Argmin/op_kernel/arg_min.cpp"
+#define REPLAY_KERNEL   arg_min
+#define REPLAY_TRACE_OP launch_trace::TRACE_OP_ARG_MIN
+#endif
+
+namespace {
+// ge::DataType 中回放需要区分的枚举值
+constexpr int32_t GE_DT_FLOAT   = 0;
+constexpr int32_t GE_DT_FLOAT16 = 1;
+constexpr int32_t GE_DT_BF16    = 27;
+
+uint16_t FloatToHalfBits(float f)
+{
+    uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+    uint32_t sign = (x >> 16) & 0x8000u;
+    int32_t  exp  = static_cast<int32_t>((x >> 23) & 0xffu) - 127 + 15;
+    uint32_t man  = x & 0x7fffffu;
+    if (exp <= 0) return static_cast<uint16_t>(sign);
+    if (exp >= 31) return static_cast<uint16_t>(sign | 0x7c00u);
+    return static_cast<uint16_t>(sign | (static_cast<uint32_t>(exp) << 10) | (man >> 13));
+}
+
+/* 按 dtype 生成可复现的输入，浮点类型取 [-1, 1) 避免 NaN/Inf 干扰比对 */
+void GenerateInput(std::vector<uint8_t> &buf, int32_t dtype, size_t elemBytes, size_t elems, uint32_t seed)
+{
+    buf.resize(elems * elemBytes);
+    uint64_t state = 0x9e3779b97f4a7c15ull ^ seed;
+    for (size_t i = 0; i < elems; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint32_t r = static_cast<uint32_t>(state >> 33);
+        float f = static_cast<float>(r) / static_cast<float>(1u << 31) * 2.0f - 1.0f;
+        uint8_t *dst = buf.data() + i * elemBytes;
+        if (dtype == GE_DT_FLOAT) {
+            std::memcpy(dst, &f, sizeof(f));
+        } else if (dtype == GE_DT_FLOAT16) {
+            uint16_t h = FloatToHalfBits(f);
+            std::memcpy(dst, &h, sizeof(h));
+        } else if (dtype == GE_DT_BF16) {
+            uint32_t bits;
+            std::memcpy(&bits, &f, sizeof(bits));
+            uint16_t b = static_cast<uint16_t>(bits >> 16);
+            std::memcpy(dst, &b, sizeof(b));
+        } else {
+            uint64_t v = state;
+            std::memcpy(dst, &v, elemBytes);
+        }
+    }
+}
+
+bool ReadFile(const char *path, std::vector<uint8_t> &buf)
+{
+    FILE *fp = std::fopen(path, "rb");
+    if (fp == nullptr) return false;
+    std::fseek(fp, 0, SEEK_END);
+    long len = std::ftell(fp);
+    std::fseek(fp, 0, SEEK_SET);
+    buf.resize(len > 0 ? static_cast<size_t>(len) : 0);
+    bool ok = std::fread(buf.data(), 1, buf.size(), fp) == buf.size();
+    std::fclose(fp);
+    return ok;
+}
+
+bool WriteFile(const char *path, const uint8_t *data, size_t len)
+{
+    FILE *fp = std::fopen(path, "wb");
+    if (fp == nullptr) return false;
+    bool ok = std::fwrite(data, 1, len, fp) == len;
+    std::fclose(fp);
+    return ok;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <file.trace> [--repeat N] [--seed S] [--input x.bin] [--mask m.bin] "
+                     "[--output y.bin]\n", argv[0]);
+        return 1;
+    }
+    const char *tracePath = argv[1];
+    const char *inputPath = nullptr;
+    const char *outputPath = nullptr;
+    const char *maskPath = nullptr;
+    int repeat = 1;
+    uint32_t seed = 0;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        std::string opt = argv[i];
+        if (opt == "--repeat") repeat = std::max(1, std::atoi(argv[i + 1]));
+        else if (opt == "--seed") seed = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        else if (opt == "--input") inputPath = argv[i + 1];
+        else if (opt == "--output") outputPath = argv[i + 1];
+        else if (opt == "--mask") maskPath = argv[i + 1];
+        else {
+            std::fprintf(stderr, "unknown option %s\n", opt.c_str());
+            return 1;
+        }
+    }
+
+    launch_trace::TraceRecord rec;
+    if (!launch_trace::ReadTrace(tracePath, rec)) {
+        std::fprintf(stderr, "failed to read trace %s\n", tracePath);
+        return 1;
+    }
+    if (rec.op != REPLAY_TRACE_OP) {
+        std::fprintf(stderr, "trace op %u does not match this replay binary\n", rec.op);
+        return 1;
+    }
+    if (rec.tiling.size() != sizeof(ReplayTilingData)) {
+        std::fprintf(stderr, "tiling size %zu != kernel struct %zu, replay_tiling.h out of date?\n",
+                     rec.tiling.size(), sizeof(ReplayTilingData));
+        return 1;
+    }
+    ReplayTilingData td;
+    std::memcpy(&td, rec.tiling.data(), sizeof(td));
+
+    size_t inElems = 1;
+    for (int64_t d : rec.dims) inElems *= static_cast<size_t>(d);
+    // x 在 GM 中实际占用的元素数，非连续视图下大于 inElems
+    size_t inExtent = inElems;
+#if defined(REPLAY_OP_EXPAND)
+    const size_t elemBytes = static_cast<size_t>(td.datatypesize);
+    // attrs 末项是 x 的存储跨度(最大偏移 + 1)
+    if (!rec.attrs.empty() && td.strided != 0) inExtent = std::max(inExtent, static_cast<size_t>(rec.attrs.back()));
+    const size_t outBytes = static_cast<size_t>(td.outputsize) * sizeof(DTYPE_X);
+#else
+    const size_t elemBytes = static_cast<size_t>(td.elem_bytes);
+    // 5HD 沿 C 归约时每 C0 个通道折叠成一个输出
+    const size_t outBytes = static_cast<size_t>(td.c0 != 0 ? td.outer / td.c0 : td.outer) * sizeof(DTYPE_Y);
+    // attrs 末三项是 [下标 dtype, masked_index, mask_bitpacked]，ge::DT_INT32 = 3
+    const size_t traceIdxBytes = (rec.attrs.size() >= 3 && rec.attrs[rec.attrs.size() - 3] == 3) ? 4 : 8;
+    if (traceIdxBytes != sizeof(DTYPE_Y)) {
+        std::fprintf(stderr, "trace index dtype is %zu bytes, replay built for %zu bytes\n", traceIdxBytes,
+                     sizeof(DTYPE_Y));
+        return 1;
+    }
+    // trace 不带掩码数据，按别的掩码回放算的是另一个结果
+    const size_t maskBytes = td.mask_bitpacked != 0 ? (inElems + 7) / 8 : inElems;
+    std::vector<uint8_t> maskData;
+    if (td.has_mask != 0) {
+        if (maskPath == nullptr) {
+            std::fprintf(stderr, "trace has a mask input that is not captured, pass it with --mask\n");
+            return 1;
+        }
+        if (!ReadFile(maskPath, maskData)) {
+            std::fprintf(stderr, "failed to read %s\n", maskPath);
+            return 1;
+        }
+        if (maskData.size() < maskBytes) {
+            std::fprintf(stderr, "mask has %zu bytes, need %zu\n", maskData.size(), maskBytes);
+            return 1;
+        }
+    }
+#endif
+    if (elemBytes != sizeof(DTYPE_X)) {
+        std::fprintf(stderr, "trace dtype is %zu bytes, replay built for %zu bytes\n", elemBytes, sizeof(DTYPE_X));
+        return 1;
+    }
+
+    std::vector<uint8_t> input;
+    if (inputPath != nullptr) {
+        if (!ReadFile(inputPath, input)) {
+            std::fprintf(stderr, "failed to read %s\n", inputPath);
+            return 1;
+        }
+    } else if (!rec.payload.empty()) {
+        input = rec.payload;
+    } else {
+        GenerateInput(input, rec.dtype, elemBytes, inExtent, seed);
+    }
+    if (input.size() < inExtent * elemBytes) {
+        std::fprintf(stderr, "input has %zu bytes, need %zu\n", input.size(), inExtent * elemBytes);
+        return 1;
+    }
+
+    // 尾部多留 32B：kernel 的对齐搬运可能越过有效数据
+    uint8_t *x      = static_cast<uint8_t *>(AscendC::GmAlloc(input.size() + 32));
+    uint8_t *y      = static_cast<uint8_t *>(AscendC::GmAlloc(outBytes + 256));
+    uint8_t *ws     = static_cast<uint8_t *>(AscendC::GmAlloc(rec.workspaceSize + 32));
+    uint8_t *tiling = static_cast<uint8_t *>(AscendC::GmAlloc(rec.tiling.size()));
+    std::memcpy(x, input.data(), input.size());
+    std::memcpy(tiling, rec.tiling.data(), rec.tiling.size());
+#if defined(REPLAY_OP_ARG_MIN)
+    // 无掩码的 launch 不读 mask，仍传一块有效地址
+    uint8_t *mask = static_cast<uint8_t *>(AscendC::GmAlloc(maskBytes + 32));
+    std::memset(mask, 0, maskBytes + 32);
+    if (!maskData.empty()) std::memcpy(mask, maskData.data(), maskBytes);
+#define REPLAY_ARGS x, mask, y, ws, tiling
+#else
+#define REPLAY_ARGS x, y, ws, tiling
+#endif
+
+    AscendC::SetKernelMode(KernelMode::AIV_MODE);
+    ICPU_SET_TILING_KEY(rec.tilingKey);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeat; ++i) {
+        ICPU_RUN_KF(REPLAY_KERNEL, rec.blockDim, REPLAY_ARGS);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double us = std::chrono::duration<double, std::micro>(end - start).count() / repeat;
+
+    std::printf("trace=%s op=%u dtype=%d tiling_key=%llu block_dim=%u workspace=%llu\n", tracePath, rec.op,
+                rec.dtype, static_cast<unsigned long long>(rec.tilingKey), rec.blockDim,
+                static_cast<unsigned long long>(rec.workspaceSize));
+    std::printf("in_bytes=%zu out_bytes=%zu repeat=%d avg_us=%.3f\n", inElems * elemBytes, outBytes, repeat, us);
+
+    int ret = 0;
+    if (outputPath != nullptr && !WriteFile(outputPath, y, outBytes)) {
+        std::fprintf(stderr, "failed to write %s\n", outputPath);
+        ret = 1;
+    }
+    AscendC::GmFree(x);
+    AscendC::GmFree(y);
+    AscendC::GmFree(ws);
+    AscendC::GmFree(tiling);
+#if defined(REPLAY_OP_ARG_MIN)
+    AscendC::GmFree(mask);
+#endif
+    return ret;
+}
@@ -0,0 +1,81 @@
+#ifndef ASCEND_OPS_REPLAY_TILING_H
+#define ASCEND_OPS_REPLAY_TILING_H
+/*
+ * CPU 孪生调试下 kernel 侧看到的 tiling 结构。
+ * 字段顺序/类型必须与 op_host 下 *_tiling.h 的 TILING_DATA_FIELD_DEF 一一对应，改 tiling 时同步修改。
+ */
+#include <cstdint>
+#include <cstring>
+
+struct ExpandTilingData {
+    int32_t outer[3];
+    int32_t repeater[3];
+    int32_t inner[3];
+    int32_t size;
+    int32_t outputsize;
+    int32_t Expandsize;
+    int32_t datatypesize;
+    int32_t strided;
+    int32_t row_blocks;
+    int32_t block_len;
+    int32_t block_gap;
+    int32_t outer_rank;
+    int32_t outer_dims[8];
+    int32_t outer_strides[8];
+};
+
+struct ArgMinTilingData {
+    uint32_t size;
+    int16_t  dim;
+    uint32_t rank;
+    uint32_t inner;
+    uint32_t outer;
+    uint32_t elem_bytes;
+    uint32_t stride_m;
+    uint32_t seg_len;
+    uint32_t outer_rank;
+    uint32_t outer_dims[4];
+    uint32_t outer_strides[4];
+    uint32_t red_rank;
+    uint32_t red_dims[4];
+    uint32_t red_strides[4];
+    uint32_t c0;
+    uint32_t c_valid;
+    uint32_t hw;
+    uint32_t has_mask;
+    uint32_t mask_bitpacked;
+    int32_t masked_index;
+};
+
+struct GroupedArgMinTilingData {
+    uint32_t group_num;
+    uint32_t item_num;
+    uint32_t slice_item_num;
+    uint32_t inner[64];
+    uint32_t outer[64];
+    uint32_t stride_m[64];
+    uint32_t item_group[256];
+    uint32_t item_begin[256];
+    uint32_t item_count[256];
+    uint32_t core_item_begin[65];
+};
+
+// 离线分析工具只需要结构体定义(见 tools/tiling_analyzer)
+#if defined(REPLAY_TILING_STRUCTS_ONLY)
+#elif defined(REPLAY_OP_EXPAND)
+using ReplayTilingData = ExpandTilingData;
+#elif defined(REPLAY_OP_ARG_MIN)
+using ReplayTilingData = ArgMinTilingData;
+#elif defined(REPLAY_OP_GROUPED_ARG_MIN)
+using ReplayTilingData = GroupedArgMinTilingData;
+#else
+#error "define REPLAY_OP_EXPAND, REPLAY_OP_ARG_MIN or REPLAY_OP_GROUPED_ARG_MIN"
+#endif
+
+#ifndef REPLAY_TILING_STRUCTS_ONLY
+#define GET_TILING_DATA(name, ptr) \
+    ReplayTilingData name;         \
+    std::memcpy(&name, (ptr), sizeof(ReplayTilingData))
+#endif
+
+#endif // ASCEND_OPS_REPLAY_TILING_H
@@ -0,0 +1,151 @@
+/*
+ * tiling_analyzer [选项] <*.trace | 目录文件>...
+ *   --cores N               目录行按 N 个 AIV 核计算 block dim(默认 1)
+ *   --max-traffic-ratio X   GM 读写 / 理论下限 超过 X 时失败
+ *   --min-avg-burst B       平均连续段字节数低于 B 时失败
+ *   --max-imbalance Y       最忙核字节数 / 各核平均 超过 Y 时失败
+ *   --min-ub-fill U         平均搬入占缓冲比例低于 U 时失败
+ *   --csv                   输出 CSV
+ * 以 .trace 结尾的参数按 launch trace 读取，其余按 shape 目录逐行读取。
+ * 返回值：0 全部通过，1 参数或输入错误，2 有 launch 超出阈值。
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "tiling_analyzer.h"
+
+namespace {
+struct Gate {
+    double maxTrafficRatio = 0;  // 0 表示不检查，下同
+    double minAvgBurst = 0;
+    double maxImbalance = 0;
+    double minUbFill = 0;
+};
+
+bool EndsWith(const std::string &s, const char *suffix)
+{
+    const size_t n = std::strlen(suffix);
+    return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+bool LoadCatalog(const std::string &path, uint32_t cores, std::vector<tiling_analyzer::Launch> &launches)
+{
+    std::ifstream in(path);
+    if (!in) {
+        std::fprintf(stderr, "%s: cannot open\n", path.c_str());
+        return false;
+    }
+    std::string line;
+    for (int lineNo = 1; std::getline(in, line); ++lineNo) {
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') continue;
+        tiling_analyzer::Launch l;
+        std::string err;
+        if (!tiling_analyzer::ParseCatalogLine(line, cores, l, err)) {
+            std::fprintf(stderr, "%s:%d: %s\n", path.c_str(), lineNo, err.c_str());
+            return false;
+        }
+        launches.push_back(l);
+    }
+    return true;
+}
+
+// 返回超出的阈值名，全部通过时为空
+std::string Check(const tiling_analyzer::Report &r, const Gate &g)
+{
+    std::string bad;
+    auto flag = [&bad](bool fail, const char *name) {
+        if (fail) bad += bad.empty() ? name : std::string(",") + name;
+    };
+    flag(g.maxTrafficRatio > 0 && r.TrafficRatio() > g.maxTrafficRatio, "traffic");
+    flag(g.minAvgBurst > 0 && r.AvgBurstBytes() < g.minAvgBurst, "burst");
+    flag(g.maxImbalance > 0 && r.imbalance > g.maxImbalance, "imbalance");
+    flag(g.minUbFill > 0 && r.ubFill < g.minUbFill, "ub_fill");
+    return bad;
+}
+
+void Print(const tiling_analyzer::Report &r, const std::string &bad, bool csv)
+{
+    if (csv) {
+        std::printf("\"%s\",%llu,%u,%llu,%llu,%llu,%llu,%.3f,%llu,%.1f,%llu,%.3f,%.3f,%s\n", r.name.c_str(),
+                    static_cast<unsigned long long>(r.tilingKey), r.blockDim,
+                    static_cast<unsigned long long>(r.readBytes), static_cast<unsigned long long>(r.writeBytes),
+                    static_cast<unsigned long long>(r.minReadBytes), static_cast<unsigned long long>(r.minWriteBytes),
+                    r.TrafficRatio(), static_cast<unsigned long long>(r.dmaCount), r.AvgBurstBytes(),
+                    static_cast<unsigned long long>(r.ubAllocBytes), r.ubFill, r.imbalance,
+                    bad.empty() ? "ok" : bad.c_str());
+        return;
+    }
+    std::printf("%-48s key=%llu cores=%u rd=%llu/%llu wr=%llu/%llu ratio=%.2f dma=%llu burst=%.0fB "
+                "ub=%lluB fill=%.2f imb=%.2f%s%s\n",
+                r.name.c_str(), static_cast<unsigned long long>(r.tilingKey), r.blockDim,
+                static_cast<unsigned long long>(r.readBytes), static_cast<unsigned long long>(r.minReadBytes),
+                static_cast<unsigned long long>(r.writeBytes), static_cast<unsigned long long>(r.minWriteBytes),
+                r.TrafficRatio(), static_cast<unsigned long long>(r.dmaCount), r.AvgBurstBytes(),
+                static_cast<unsigned long long>(r.ubAllocBytes), r.ubFill, r.imbalance,
+                bad.empty() ? "" : "  FAIL:", bad.c_str());
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Gate gate;
+    uint32_t cores = 1;
+    bool csv = false;
+    std::vector<std::string> inputs;
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (a == "--cores" && hasValue) cores = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (a == "--max-traffic-ratio" && hasValue) gate.maxTrafficRatio = std::atof(argv[++i]);
+        else if (a == "--min-avg-burst" && hasValue) gate.minAvgBurst = std::atof(argv[++i]);
+        else if (a == "--max-imbalance" && hasValue) gate.maxImbalance = std::atof(argv[++i]);
+        else if (a == "--min-ub-fill" && hasValue) gate.minUbFill = std::atof(argv[++i]);
+        else if (a == "--csv") csv = true;
+        else if (!a.empty() && a[0] == '-') {
+            std::fprintf(stderr, "unknown option %s\n", a.c_str());
+            return 1;
+        } else inputs.push_back(a);
+    }
+    if (inputs.empty() || cores == 0) {
+        std::fprintf(stderr, "usage: %s [--cores N] [--max-traffic-ratio X] [--min-avg-burst B] "
+                             "[--max-imbalance Y] [--min-ub-fill U] [--csv] <file.trace|catalog>...\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<tiling_analyzer::Launch> launches;
+    for (const auto &path : inputs) {
+        if (EndsWith(path, ".trace")) {
+            tiling_analyzer::Launch l;
+            std::string err;
+            if (!tiling_analyzer::LoadTrace(path, l, err)) {
+                std::fprintf(stderr, "%s: %s\n", path.c_str(), err.c_str());
+                return 1;
+            }
+            launches.push_back(l);
+        } else if (!LoadCatalog(path, cores, launches)) {
+            return 1;
+        }
+    }
+
+    if (csv) {
+        std::printf("name,tiling_key,block_dim,read_bytes,write_bytes,min_read_bytes,min_write_bytes,"
+                    "traffic_ratio,dma_count,avg_burst_bytes,ub_alloc_bytes,ub_fill,imbalance,status\n");
+    }
+    int failed = 0;
+    for (const auto &l : launches) {
+        const tiling_analyzer::Report r = tiling_analyzer::Analyze(l);
+        const std::string bad = Check(r, gate);
+        Print(r, bad, csv);
+        failed += bad.empty() ? 0 : 1;
+    }
+    if (failed > 0) {
+        std::fprintf(stderr, "%d of %zu launches over threshold\n", failed, launches.size());
+        return 2;
+    }
+    return 0;
+}
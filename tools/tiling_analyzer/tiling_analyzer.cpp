@@ -0,0 +1,592 @@
+#include "tiling_analyzer.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+#include "../../common/launch_trace.h"
+#include "../../Argmin/op_host/arg_min_layout.h"
+#include "../../Expand/op_host/expand_layout.h"
+
+namespace tiling_analyzer {
+namespace {
+// ---- 与 kernel 保持一致的 UB 常量 ----
+// Expand/op_kernel/expand.cpp
+constexpr uint64_t EXPAND_UB_BYTES = 240 * 1024;
+constexpr uint64_t EXPAND_BUFFER_NUM = 2;
+constexpr uint64_t EXPAND_FILL_PAD_BYTES = 4 * 1024;  // MyFillPad 的标量补齐上限
+// Argmin/op_kernel/kernel_arg_min.h
+constexpr uint64_t ARG_MIN_TILE_INNER = 24576;
+constexpr uint64_t ARG_MIN_TILE_INNER_INT64 = 12288;
+constexpr uint64_t ARG_MIN_SLICE_OUT_BATCH = 256;
+
+uint64_t RoundUp(uint64_t n, uint64_t a) { return (n + a - 1) / a * a; }
+uint64_t CeilDiv(uint64_t n, uint64_t d) { return (n + d - 1) / d; }
+uint64_t Gcd(uint64_t a, uint64_t b)
+{
+    while (b != 0) {
+        uint64_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/* 按核累计 GM 流量与 DMA 次数 */
+class Sim {
+public:
+    explicit Sim(uint32_t cores) : bytes_(std::max<uint32_t>(1, cores), 0) {}
+
+    // n 次相同的搬入，每次 bytes 字节、bursts 段，落在容量 buf 字节的 UB 缓冲中
+    void Read(uint32_t core, uint64_t n, uint64_t bytes, uint64_t bursts, uint64_t buf)
+    {
+        if (n == 0) return;
+        read_ += n * bytes;
+        dma_ += n;
+        bursts_ += n * bursts;
+        bytes_[core] += n * bytes;
+        fillSum_ += static_cast<double>(n) * std::min(1.0, static_cast<double>(bytes) / static_cast<double>(buf));
+        fillN_ += n;
+    }
+
+    void Write(uint32_t core, uint64_t n, uint64_t bytes, uint64_t bursts)
+    {
+        if (n == 0) return;
+        write_ += n * bytes;
+        dma_ += n;
+        bursts_ += n * bursts;
+        bytes_[core] += n * bytes;
+    }
+
+    uint32_t Cores() const { return static_cast<uint32_t>(bytes_.size()); }
+
+    void Finish(Report &r) const
+    {
+        r.readBytes = read_;
+        r.writeBytes = write_;
+        r.dmaCount = dma_;
+        r.burstCount = bursts_;
+        r.ubFill = fillN_ == 0 ? 0 : fillSum_ / static_cast<double>(fillN_);
+        uint64_t sum = 0;
+        for (uint64_t b : bytes_) {
+            sum += b;
+            r.maxCoreBytes = std::max(r.maxCoreBytes, b);
+        }
+        r.imbalance = sum == 0 ? 1 : static_cast<double>(r.maxCoreBytes) * bytes_.size() / static_cast<double>(sum);
+    }
+
+private:
+    std::vector<uint64_t> bytes_;
+    uint64_t read_ = 0;
+    uint64_t write_ = 0;
+    uint64_t dma_ = 0;
+    uint64_t bursts_ = 0;
+    double fillSum_ = 0;
+    uint64_t fillN_ = 0;
+};
+
+/* ---------------- Expand：镜像 KernelExpand 的循环 ---------------- */
+class ExpandModel {
+public:
+    ExpandModel(const ExpandTilingData &t, Sim &sim) : t_(t), sim_(sim)
+    {
+        sz_ = static_cast<uint64_t>(std::max(1, t.datatypesize));
+        bufBytes_ = EXPAND_UB_BYTES / EXPAND_BUFFER_NUM;
+        ubElems_ = bufBytes_ / sz_;
+        align_ = 32 / sz_;
+    }
+
+    void Process()
+    {
+        const uint32_t cores = sim_.Cores();
+        for (int32_t idx = 0; idx < t_.Expandsize; ++idx) {
+            const uint64_t outer = t_.outer[idx];
+            if (idx == 0 && t_.strided) {
+                for (uint32_t c = 0; c < cores; ++c) {
+                    const uint64_t rows = outer > c ? CeilDiv(outer - c, cores) : 0;
+                    StridedRows(c, rows);
+                }
+                continue;
+            }
+            if (outer == 1) {
+                for (uint32_t c = 0; c < cores; ++c) BlockReplicate(c, idx);
+                continue;
+            }
+            const uint64_t inner = t_.inner[idx];
+            uint64_t step = 1;
+            if (inner * sz_ >= 32) step = std::max<uint64_t>(1, std::min(outer, ubElems_ / inner));
+            for (uint32_t c = 0; c < cores; ++c) {
+                for (uint64_t o = step * c; o < outer; o += step * cores) {
+                    TileBroadcast(c, idx, std::min(step, outer - o));
+                }
+            }
+        }
+    }
+
+private:
+    // computeExpandVec 之后 UB 中可一次写出的元素数
+    uint64_t Filled(uint64_t cur, uint64_t inner, uint64_t repeat) const
+    {
+        if (inner == 1) return std::min(ubElems_, repeat);
+        if (inner * sz_ > 32) return cur;
+        return Doubled(cur, std::min(ubElems_, repeat * inner));
+    }
+
+    // MyFillPad 补到 32B 对齐后 MyCopy 倍增
+    uint64_t Doubled(uint64_t filled, uint64_t all) const
+    {
+        if (filled % align_ != 0) {
+            const uint64_t r = align_ / Gcd(filled, align_);
+            if (r * filled * sz_ <= EXPAND_FILL_PAD_BYTES) filled *= r;
+        }
+        if (filled % align_ == 0) {
+            while (filled * 2 <= all) filled <<= 1;
+        }
+        return filled;
+    }
+
+    // 写出 repeat 行、每行 width 个元素，UB 中一次可写 rowsInVec 行
+    void CopyOut(uint32_t c, uint64_t repeat, uint64_t width, uint64_t rowsInVec)
+    {
+        rowsInVec = std::max<uint64_t>(1, rowsInVec);
+        const uint64_t full = repeat / rowsInVec;
+        sim_.Write(c, full, rowsInVec * width * sz_, 1);
+        if (repeat % rowsInVec != 0) sim_.Write(c, 1, (repeat % rowsInVec) * width * sz_, 1);
+    }
+
+    void RowBroadcast(uint32_t c, uint64_t inner, uint64_t repeat)
+    {
+        const uint64_t chunk = std::min(ubElems_, inner);
+        for (uint64_t off = 0; off < inner; off += chunk) {
+            const uint64_t cur = std::min(chunk, inner - off);
+            // copyIn 用 DataCopy，按 32B 取整
+            sim_.Read(c, 1, RoundUp(cur * sz_, 32), 1, bufBytes_);
+            CopyOut(c, repeat, std::min(cur, inner), Filled(cur, inner, repeat) / inner);
+        }
+    }
+
+    void TileBroadcast(uint32_t c, int32_t idx, uint64_t step)
+    {
+        const uint64_t inner = t_.inner[idx];
+        const uint64_t repeat = t_.repeater[idx];
+        if (step <= 1) {
+            RowBroadcast(c, inner, repeat);
+            return;
+        }
+        sim_.Read(c, 1, step * inner * sz_, step, bufBytes_);
+        sim_.Write(c, repeat, step * inner * sz_, step);
+    }
+
+    void BlockReplicate(uint32_t c, int32_t idx)
+    {
+        const uint64_t block = t_.inner[idx];
+        const uint64_t repeat = t_.repeater[idx];
+        const uint64_t perCore = CeilDiv(repeat, sim_.Cores());
+        const uint64_t begin = perCore * c;
+        if (begin >= repeat) return;
+        const uint64_t rows = std::min(perCore, repeat - begin);
+        if (block > ubElems_ || block * sz_ <= 32) {
+            RowBroadcast(c, block, rows);
+            return;
+        }
+        sim_.Read(c, 1, RoundUp(block * sz_, 32), 1, bufBytes_);
+        CopyOut(c, rows, block, Doubled(block, std::min(ubElems_, rows * block)) / block);
+    }
+
+    void StridedRows(uint32_t c, uint64_t rows)
+    {
+        const uint64_t inner = t_.inner[0];
+        const uint64_t repeat = t_.repeater[0];
+        for (uint64_t r = 0; r < rows && t_.row_blocks == 1; ++r) RowBroadcast(c, inner, repeat);
+        if (t_.row_blocks == 1) return;
+        const uint64_t rowBytes = static_cast<uint64_t>(t_.row_blocks) * t_.block_len * sz_;
+        sim_.Read(c, rows, rowBytes, t_.row_blocks, bufBytes_);
+        sim_.Write(c, rows * repeat, rowBytes, t_.row_blocks);
+    }
+
+    const ExpandTilingData &t_;
+    Sim &sim_;
+    uint64_t sz_, bufBytes_, ubElems_, align_;
+};
+
+/* ---------------- ArgMin：镜像 KernelArgMin 的 slice / 平面路径 ---------------- */
+struct ArgMinTiles {
+    uint64_t tileInner;
+    uint64_t colTile;
+    uint64_t ubSlice;
+    uint64_t ubPlane;
+};
+
+// KernelArgMin::TILE_COL / TILE_INNER 与 InitSliceBuffers / InitPlaneBuffers
+ArgMinTiles ArgMinUb(int32_t dtype, uint32_t idxBytes, const ArgMinTilingData &t)
+{
+    const uint64_t sz = DataTypeBytes(dtype);
+    const uint64_t cmp = dtype == GE_DT_BF16 ? 4 : sz;
+    ArgMinTiles u;
+    u.tileInner = dtype == GE_DT_INT64 ? ARG_MIN_TILE_INNER_INT64 : ARG_MIN_TILE_INNER;
+    uint64_t col;
+    if (dtype == GE_DT_INT64) col = idxBytes == 4 ? 8192 : 5120;
+    else if (idxBytes == 8) col = 10240;
+    else if (dtype == GE_DT_FLOAT16) col = 20480;
+    else col = 14336;
+    if (t.has_mask) col /= 2;
+    u.colTile = col;
+
+    const bool packed = t.mask_bitpacked != 0;
+    auto maskBytes = [packed](uint64_t n, uint64_t depth) {
+        return depth * ((packed ? n / 8 : n) + 32) + (packed ? 0 : n * 2 + 32) + n / 8 + 32;
+    };
+    u.ubSlice = u.tileInner * sz + 32 + 32 + ARG_MIN_SLICE_OUT_BATCH * idxBytes +
+                (t.has_mask ? maskBytes(u.tileInner, 1) : 0);
+    u.ubPlane = 2 * (col * sz + 32) + col / 8 + 32 + (dtype == GE_DT_BF16 ? col * 4 + 32 : 0);
+    if (idxBytes == 4) {
+        u.ubPlane += col * cmp + 32 + col * 4 + 32;
+    } else {
+        u.ubPlane += col * 4 + 32 + col * 8 + 256;
+    }
+    if (t.has_mask) u.ubPlane += maskBytes(col, 2) + 2 * (col * 2 + 32) + col / 8 + 32;
+    return u;
+}
+
+void ArgMinProcess(const Launch &l, Sim &sim, Report &r)
+{
+    const ArgMinTilingData &t = l.argMin;
+    const uint64_t sz = DataTypeBytes(l.dtype);
+    const ArgMinTiles u = ArgMinUb(l.dtype, l.idxBytes, t);
+    const bool packed = t.mask_bitpacked != 0;
+    auto maskRead = [&](uint32_t c, uint64_t n, uint64_t elems, uint64_t buf) {
+        if (t.has_mask) sim.Read(c, n, packed ? CeilDiv(elems, 8) : elems, 1, buf);
+    };
+    const uint32_t cores = sim.Cores();
+
+    if (l.tilingKey == 1) {
+        // 每个 slice 相同：inner / seg_len 段，每段按 TILE_INNER 切块，DataCopy 按 32B 取整；
+        // slice 按核连续切分，结果每 SLICE_OUT_BATCH 个一次写回
+        r.ubAllocBytes = u.ubSlice;
+        const uint64_t segLen = t.seg_len == 0 ? t.inner : t.seg_len;
+        const uint64_t segs = segLen == 0 ? 0 : t.inner / segLen;
+        const uint64_t fullChunks = segLen / u.tileInner;
+        const uint64_t tail = segLen % u.tileInner;
+        for (uint32_t c = 0; c < cores; ++c) {
+            const uint64_t per = CeilDiv(t.outer, cores);
+            const uint64_t begin = std::min<uint64_t>(t.outer, c * per);
+            const uint64_t slices = std::min<uint64_t>(t.outer, begin + per) - begin;
+            const uint64_t n = slices * segs;
+            sim.Read(c, n * fullChunks, u.tileInner * sz, 1, u.tileInner * sz);
+            maskRead(c, n * fullChunks, u.tileInner, u.tileInner);
+            if (tail != 0) {
+                sim.Read(c, n, RoundUp(tail * sz, 32), 1, u.tileInner * sz);
+                maskRead(c, n, tail, u.tileInner);
+            }
+            sim.Write(c, slices / ARG_MIN_SLICE_OUT_BATCH, ARG_MIN_SLICE_OUT_BATCH * l.idxBytes, 1);
+            sim.Write(c, slices % ARG_MIN_SLICE_OUT_BATCH != 0 ? 1 : 0,
+                      (slices % ARG_MIN_SLICE_OUT_BATCH) * l.idxBytes, 1);
+        }
+        return;
+    }
+
+    // 平面路径：每个平面 stride_m 列按 colTile 切块，每块逐行搬入 inner 行，写回一次
+    r.ubAllocBytes = u.ubPlane;
+    const uint64_t planes = t.stride_m == 0 ? 0 : t.outer / t.stride_m;
+    const uint64_t fullChunks = t.stride_m / u.colTile;
+    const uint64_t tail = t.stride_m % u.colTile;
+    auto outBytes = [&](uint64_t cols) { return (t.c0 != 0 ? cols / t.c0 : cols) * l.idxBytes; };
+    for (uint32_t c = 0; c < cores; ++c) {
+        const uint64_t n = planes > c ? CeilDiv(planes - c, cores) : 0;
+        sim.Read(c, n * fullChunks * t.inner, u.colTile * sz, 1, u.colTile * sz);
+        maskRead(c, n * fullChunks * t.inner, u.colTile, u.colTile);
+        sim.Write(c, n * fullChunks, outBytes(u.colTile), 1);
+        if (tail != 0) {
+            sim.Read(c, n * t.inner, RoundUp(tail * sz, 32), 1, u.colTile * sz);
+            maskRead(c, n * t.inner, tail, u.colTile);
+            sim.Write(c, n, outBytes(tail), 1);
+        }
+    }
+}
+
+bool ParseInt(const std::string &s, int64_t &v)
+{
+    char *end = nullptr;
+    errno = 0;
+    long long n = std::strtoll(s.c_str(), &end, 10);
+    if (s.empty() || *end != '\0' || errno == ERANGE) return false;
+    v = n;
+    return true;
+}
+
+bool ParseDims(const std::string &s, std::vector<int64_t> &dims)
+{
+    dims.clear();
+    if (s.empty() || s == "-") return true;  // "-" 表示标量
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        int64_t v;
+        if (!ParseInt(item, v)) return false;
+        dims.push_back(v);
+    }
+    return true;
+}
+
+bool ParseDataType(const std::string &s, int32_t &dtype)
+{
+    static const struct { const char *name; int32_t dtype; } kTypes[] = {
+        {"float32", GE_DT_FLOAT}, {"float", GE_DT_FLOAT}, {"float16", GE_DT_FLOAT16}, {"half", GE_DT_FLOAT16},
+        {"bfloat16", GE_DT_BF16}, {"int8", GE_DT_INT8}, {"uint8", GE_DT_UINT8}, {"int16", GE_DT_INT16},
+        {"int32", GE_DT_INT32}, {"int64", GE_DT_INT64}, {"bool", GE_DT_BOOL},
+    };
+    for (const auto &t : kTypes) {
+        if (s == t.name) {
+            dtype = t.dtype;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* 与 Expand/op_host/expand.cpp 的 ComputeTiling 相同(目录不描述非连续输入) */
+bool ExpandFromCatalog(const std::vector<int64_t> &x, const std::vector<int64_t> &size, uint32_t cores,
+                       Launch &l, std::string &err)
+{
+    const size_t rank = size.size();
+    if (rank < x.size() || rank > 8) {
+        err = "size rank must be >= x rank and <= 8";
+        return false;
+    }
+    int64_t xd[8];
+    const size_t lead = rank - x.size();
+    for (size_t i = 0; i < rank; ++i) {
+        xd[i] = i < lead ? 1 : x[i - lead];
+        if (xd[i] != 1 && xd[i] != size[i]) {
+            err = "x is not broadcastable to size";
+            return false;
+        }
+    }
+    expand_layout::ExpandLayout e;
+    if (!expand_layout::ComputeExpandLayout(xd, size.data(), static_cast<int32_t>(rank), e)) {
+        err = "more than 3 broadcast levels";
+        return false;
+    }
+    ExpandTilingData &t = l.expand;
+    t = ExpandTilingData();
+    for (int32_t j = 0; j < e.levels; ++j) {
+        t.outer[j] = static_cast<int32_t>(e.outer[j]);
+        t.inner[j] = static_cast<int32_t>(e.inner[j]);
+        t.repeater[j] = static_cast<int32_t>(e.repeater[j]);
+    }
+    t.size = static_cast<int32_t>(e.in_elems);
+    t.outputsize = static_cast<int32_t>(e.out_elems);
+    t.Expandsize = e.levels;
+    t.datatypesize = static_cast<int32_t>(DataTypeBytes(l.dtype));
+    t.row_blocks = 1;
+    l.tilingKey = 0;
+    l.blockDim = 1;
+    if (e.levels == 1) {
+        const uint64_t units = e.outer[0] == 1 ? e.repeater[0] : e.outer[0];
+        l.blockDim = static_cast<uint32_t>(std::max<uint64_t>(1, std::min<uint64_t>(cores, units)));
+    }
+    return true;
+}
+
+/* 与 Argmin/op_host/arg_min.cpp 的 ComputeTiling、CheckMask 相同(ND；NC1HWC0 需从 trace 分析) */
+bool ArgMinFromCatalog(const std::vector<int64_t> &x, int64_t dim, const std::vector<int64_t> &dims,
+                       bool mask, bool packed, Launch &l, std::string &err)
+{
+    arg_min_layout::ArgMinLayout layout;
+    const int32_t rank = static_cast<int32_t>(x.size());
+    bool ok = dims.empty()
+                  ? arg_min_layout::ComputeArgMinLayout(x.data(), rank, dim, layout)
+                  : rank > 0 && arg_min_layout::ComputeArgMinLayoutMulti(x.data(), rank, dims.data(),
+                                                                         static_cast<int32_t>(dims.size()), layout);
+    if (!ok) {
+        err = "invalid reduce dims";
+        return false;
+    }
+    if (l.idxBytes == 4 && layout.inner > static_cast<uint64_t>(INT32_MAX)) {
+        err = "idx=int32 cannot index more than INT32_MAX reduced elements";
+        return false;
+    }
+    // 按位打包的掩码要求每段连续归约元素从字节边界开始
+    if (packed) {
+        const uint64_t run = layout.stride_m == 1 ? layout.seg_len : layout.stride_m;
+        const bool single = layout.outer == 1 && layout.inner == layout.seg_len;
+        if (run % 8 != 0 && !single) {
+            err = "mask=packed needs the contiguous reduce run to be a multiple of 8";
+            return false;
+        }
+    }
+    ArgMinTilingData &t = l.argMin;
+    t = ArgMinTilingData();
+    t.size = static_cast<uint32_t>(layout.total);
+    t.dim = layout.dim;
+    t.rank = static_cast<uint32_t>(rank);
+    t.inner = static_cast<uint32_t>(layout.inner);
+    t.outer = static_cast<uint32_t>(layout.outer);
+    t.elem_bytes = DataTypeBytes(l.dtype);
+    t.stride_m = static_cast<uint32_t>(layout.stride_m);
+    t.seg_len = static_cast<uint32_t>(layout.seg_len);
+    t.outer_rank = layout.outer_rank;
+    t.red_rank = layout.red_rank;
+    for (int32_t i = 0; i < arg_min_layout::MAX_GROUPS; ++i) {
+        t.outer_dims[i] = static_cast<uint32_t>(layout.outer_dims[i]);
+        t.outer_strides[i] = static_cast<uint32_t>(layout.outer_strides[i]);
+        t.red_dims[i] = static_cast<uint32_t>(layout.red_dims[i]);
+        t.red_strides[i] = static_cast<uint32_t>(layout.red_strides[i]);
+    }
+    t.has_mask = mask ? 1 : 0;
+    t.mask_bitpacked = packed ? 1 : 0;
+    t.masked_index = -1;
+    l.tilingKey = layout.stride_m == 1 ? 1 : 0;
+    l.blockDim = 1;
+    return true;
+}
+} // namespace
+
+double Report::TrafficRatio() const
+{
+    const uint64_t min = minReadBytes + minWriteBytes;
+    return min == 0 ? 1 : static_cast<double>(readBytes + writeBytes) / static_cast<double>(min);
+}
+
+double Report::AvgDmaBytes() const
+{
+    return dmaCount == 0 ? 0 : static_cast<double>(readBytes + writeBytes) / static_cast<double>(dmaCount);
+}
+
+double Report::AvgBurstBytes() const
+{
+    return burstCount == 0 ? 0 : static_cast<double>(readBytes + writeBytes) / static_cast<double>(burstCount);
+}
+
+uint32_t DataTypeBytes(int32_t dtype)
+{
+    switch (dtype) {
+        case GE_DT_INT8:
+        case GE_DT_UINT8:
+        case GE_DT_BOOL:
+            return 1;
+        case GE_DT_FLOAT16:
+        case GE_DT_BF16:
+        case GE_DT_INT16:
+            return 2;
+        case GE_DT_INT64:
+            return 8;
+        default:
+            return 4;
+    }
+}
+
+/*
+ * 目录行: <op> <dtype> <x 的 shape> [key=value ...]，'#' 之后为注释，shape 用逗号分隔，"-" 表示标量
+ *   expand  float16 4,1,8 size=4,16,8
+ *   arg_min float32 32,1024 dim=1 idx=int32 mask=bool
+ *   arg_min float16 2,3,4,5 dims=1,3
+ * arg_min 的 dim 缺省为全局归约；idx 为 int64(缺省)/int32；mask 为 none(缺省)/bool/packed
+ */
+bool ParseCatalogLine(const std::string &line, uint32_t cores, Launch &l, std::string &err)
+{
+    std::stringstream ss(line.substr(0, line.find('#')));
+    std::string op, dtype, shape, kv;
+    if (!(ss >> op >> dtype >> shape)) {
+        err = "expected <op> <dtype> <shape>";
+        return false;
+    }
+    std::vector<int64_t> x, size, dims;
+    if (!ParseDataType(dtype, l.dtype) || !ParseDims(shape, x)) {
+        err = "bad dtype or shape";
+        return false;
+    }
+    int64_t dim = arg_min_layout::GLOBAL_REDUCE_DIM;
+    bool mask = false, packed = false;
+    l.idxBytes = 8;
+    while (ss >> kv) {
+        const size_t eq = kv.find('=');
+        const std::string key = kv.substr(0, eq);
+        const std::string val = eq == std::string::npos ? "" : kv.substr(eq + 1);
+        bool ok = true;
+        if (key == "size") ok = ParseDims(val, size);
+        else if (key == "dims") ok = ParseDims(val, dims);
+        else if (key == "dim") ok = ParseInt(val, dim);
+        else if (key == "idx") {
+            ok = val == "int32" || val == "int64";
+            l.idxBytes = val == "int32" ? 4 : 8;
+        } else if (key == "mask") {
+            ok = val == "none" || val == "bool" || val == "packed";
+            mask = val == "bool" || val == "packed";
+            packed = val == "packed";
+        } else ok = false;
+        if (!ok) {
+            err = "bad option " + kv;
+            return false;
+        }
+    }
+    l.name = line.substr(0, line.find('#'));
+    while (!l.name.empty() && (l.name.back() == ' ' || l.name.back() == '\t')) l.name.pop_back();
+    if (op == "expand") {
+        l.op = Op::EXPAND;
+        return ExpandFromCatalog(x, size, cores, l, err);
+    }
+    if (op == "arg_min") {
+        l.op = Op::ARG_MIN;
+        return ArgMinFromCatalog(x, dim, dims, mask, packed, l, err);
+    }
+    err = "unknown op " + op;
+    return false;
+}
+
+bool LoadTrace(const std::string &path, Launch &l, std::string &err)
+{
+    launch_trace::TraceRecord rec;
+    if (!launch_trace::ReadTrace(path.c_str(), rec)) {
+        err = "cannot read trace";
+        return false;
+    }
+    l.name = path;
+    l.dtype = rec.dtype;
+    l.tilingKey = rec.tilingKey;
+    l.blockDim = std::max<uint32_t>(1, rec.blockDim);
+    if (rec.op == launch_trace::TRACE_OP_EXPAND && rec.tiling.size() == sizeof(ExpandTilingData)) {
+        l.op = Op::EXPAND;
+        std::memcpy(&l.expand, rec.tiling.data(), sizeof(ExpandTilingData));
+        return true;
+    }
+    if (rec.op == launch_trace::TRACE_OP_ARG_MIN && rec.tiling.size() == sizeof(ArgMinTilingData)) {
+        l.op = Op::ARG_MIN;
+        std::memcpy(&l.argMin, rec.tiling.data(), sizeof(ArgMinTilingData));
+        // attrs 末三项是 [下标 dtype, masked_index, mask_bitpacked]
+        l.idxBytes = (rec.attrs.size() >= 3 && rec.attrs[rec.attrs.size() - 3] == GE_DT_INT32) ? 4 : 8;
+        return true;
+    }
+    err = "unknown op or tiling size mismatch (replay_tiling.h out of date?)";
+    return false;
+}
+
+Report Analyze(const Launch &l)
+{
+    Report r;
+    r.name = l.name;
+    r.blockDim = l.blockDim;
+    r.tilingKey = l.tilingKey;
+    Sim sim(l.blockDim);
+    if (l.op == Op::EXPAND) {
+        const uint64_t sz = static_cast<uint64_t>(std::max(1, l.expand.datatypesize));
+        r.minReadBytes = static_cast<uint64_t>(l.expand.size) * sz;
+        r.minWriteBytes = static_cast<uint64_t>(l.expand.outputsize) * sz;
+        r.ubAllocBytes = EXPAND_UB_BYTES;
+        ExpandModel(l.expand, sim).Process();
+    } else {
+        const ArgMinTilingData &t = l.argMin;
+        const uint64_t sz = DataTypeBytes(l.dtype);
+        const uint64_t total = static_cast<uint64_t>(t.inner) * t.outer;
+        r.minReadBytes = total * sz;
+        if (t.has_mask) r.minReadBytes += t.mask_bitpacked ? CeilDiv(total, 8) : total;
+        r.minWriteBytes = static_cast<uint64_t>(t.c0 != 0 ? t.outer / t.c0 : t.outer) * l.idxBytes;
+        ArgMinProcess(l, sim, r);
+    }
+    sim.Finish(r);
+    return r;
+}
+} // namespace tiling_analyzer
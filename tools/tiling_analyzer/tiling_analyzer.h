@@ -0,0 +1,79 @@
+#ifndef ASCEND_OPS_TILING_ANALYZER_H
+#define ASCEND_OPS_TILING_ANALYZER_H
+/*
+ * tiling 的静态分析：不跑 kernel，按 kernel 的循环结构符号化地走一遍 tiling，
+ * 统计 GM 读写字节(对比理论下限)、DMA 指令数、平均 burst、UB 占用与各核负载。
+ *   Expand: KernelExpand::Process 的逐级广播(performTileBroadcast / performRowBroadcast /
+ *           performBlockReplicate / performStridedTileBroadcast)
+ *   ArgMin: KernelArgMin 的 ReduceContiguousSlice(tiling key 1)与 ReducePlane(tiling key 0/2)
+ * 输入是 TilingFunc 的输出：launch trace(见 common/launch_trace.h)里的 tiling 字节，
+ * 或由 shape 目录按与 TilingFunc 相同的轴分解(expand_layout.h / arg_min_layout.h)算出的 tiling。
+ * kernel 中的 UB 常量(UB_BYTES、TILE_COL、TILE_INNER)在 tiling_analyzer.cpp 中有一份副本，改 kernel 时同步。
+ */
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#define REPLAY_TILING_STRUCTS_ONLY
+#include "../replay/replay_tiling.h"
+
+namespace tiling_analyzer {
+// ge::DataType 中用到的枚举值
+enum GeDataType : int32_t {
+    GE_DT_FLOAT   = 0,
+    GE_DT_FLOAT16 = 1,
+    GE_DT_INT8    = 2,
+    GE_DT_INT32   = 3,
+    GE_DT_UINT8   = 4,
+    GE_DT_INT16   = 6,
+    GE_DT_INT64   = 9,
+    GE_DT_BOOL    = 12,
+    GE_DT_BF16    = 27,
+};
+
+enum class Op { EXPAND, ARG_MIN };
+
+/* 一次 launch：算子、输入 dtype 与 TilingFunc 的输出 */
+struct Launch {
+    std::string name;            // 报告中的标识(trace 路径或目录行)
+    Op op = Op::EXPAND;
+    int32_t dtype = GE_DT_FLOAT;
+    uint32_t idxBytes = 8;       // ArgMin 输出下标字节数
+    uint64_t tilingKey = 0;
+    uint32_t blockDim = 1;
+    ExpandTilingData expand = {};
+    ArgMinTilingData argMin = {};
+};
+
+struct Report {
+    std::string name;
+    uint32_t blockDim = 1;
+    uint64_t tilingKey = 0;
+    uint64_t readBytes = 0;
+    uint64_t writeBytes = 0;
+    uint64_t minReadBytes = 0;    // 每个输入元素读一次
+    uint64_t minWriteBytes = 0;   // 每个输出元素写一次
+    uint64_t dmaCount = 0;        // MTE2 + MTE3 指令数(GM 标量写按 1 次计)
+    uint64_t burstCount = 0;      // 连续段数，DataCopyPad 的 blockCount 计为多段
+    uint64_t ubAllocBytes = 0;    // kernel Init 时分配的 UB
+    double ubFill = 0;            // 每次搬入占所用缓冲容量的平均比例
+    double imbalance = 1;         // 最忙核的 GM 字节数 / 各核平均
+    uint64_t maxCoreBytes = 0;
+
+    double TrafficRatio() const;  // (读 + 写) / 理论下限
+    double AvgDmaBytes() const;
+    double AvgBurstBytes() const;
+};
+
+uint32_t DataTypeBytes(int32_t dtype);
+
+/* shape 目录的一行，格式见 tiling_analyzer.cpp 的 ParseCatalogLine；失败时 err 给出原因 */
+bool ParseCatalogLine(const std::string &line, uint32_t cores, Launch &launch, std::string &err);
+
+/* 从 .trace 文件取 tiling；tiling 大小与镜像结构体不一致时失败 */
+bool LoadTrace(const std::string &path, Launch &launch, std::string &err);
+
+Report Analyze(const Launch &launch);
+} // namespace tiling_analyzer
+
+#endif // ASCEND_OPS_TILING_ANALYZER_H